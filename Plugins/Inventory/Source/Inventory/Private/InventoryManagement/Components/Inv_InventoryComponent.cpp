@@ -3,8 +3,13 @@
 
 #include "InventoryManagement/Components/Inv_InventoryComponent.h"
 
+#include "Inventory.h"
+#include "Async/Async.h"
+#include "InventoryManagement/Grid/Inv_GridTidySolver.h"
 #include "Items/Components/Inv_ItemComponent.h"
+#include "Items/Manifest/Inv_ItemDefinitionRegistry.h"
 #include "Net/UnrealNetwork.h"
+#include "Tasks/Task.h"
 #include "Widgets/Inventory/InventoryBase/Inv_InventoryBase.h"
 #include "Items/Inv_InventoryItem.h"
 #include "Items/Fragments/Inv_ItemFragment.h"
@@ -21,6 +26,11 @@ UInv_InventoryComponent::UInv_InventoryComponent() : InventoryList(this)
 	bReplicateUsingRegisteredSubObjectList = true;
 
 	bInventoryMenuOpen = false;
+
+	// 카테고리별 기본 그리드 크기 (X = 열 수, Y = 행 수)
+	GridSizes.Add(EInv_ItemCategory::Equippable, FIntPoint(8, 6));
+	GridSizes.Add(EInv_ItemCategory::Consumable, FIntPoint(8, 6));
+	GridSizes.Add(EInv_ItemCategory::Craftable, FIntPoint(8, 6));
 }
 
 void UInv_InventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -29,12 +39,13 @@ void UInv_InventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 
 	// 인벤토리 리스트를 복제 속성으로 등록
 	DOREPLIFETIME(ThisClass, InventoryList);
+	DOREPLIFETIME_CONDITION(ThisClass, AppliedGridEdits, COND_OwnerOnly);
 }
 
 void UInv_InventoryComponent::TryAddItem(UInv_ItemComponent* ItemComponent)
 {
-	// 인벤토리에 아이템을 추가할 공간이 있는지 확인
-	FInv_SlotAvailabilityResult Result = InventoryMenu->HasRoomForItem(ItemComponent);
+	// 인벤토리에 아이템을 추가할 공간이 있는지 그리드 모델에서 확인
+	FInv_SlotAvailabilityResult Result = HasRoomForItem(ItemComponent);
 
 	// 같은 타입의 아이템이 이미 인벤토리에 있는지 검색
 	UInv_InventoryItem* FoundItem = InventoryList.FindFirstItemByType(ItemComponent->GetItemManifest().GetItemType());
@@ -50,21 +61,40 @@ void UInv_InventoryComponent::TryAddItem(UInv_ItemComponent* ItemComponent)
 	// 기존 아이템이 있고 스택 가능하면 스택에 추가
 	if (Result.Item.IsValid() && Result.bStackable)
 	{
-		OnStackChange.Broadcast(Result);
-		Server_AddStacksToItem(ItemComponent, Result.TotalRoomToFill, Result.Remainder);
+		// 클라이언트는 서버와 같은 결과를 로컬 모델에 먼저 적용합니다 (서버에서는 RPC 안에서 적용됨)
+		if (!GetOwner()->HasAuthority())
+		{
+			ApplyStacksToGrid(Result);
+			RecordGridEdit(Result.Item.Get());
+		}
+		Server_AddStacksToItem(ItemComponent);
 	}
 	// 새로운 아이템으로 추가
 	else if (Result.TotalRoomToFill > 0)
 	{
-		Server_AddNewItem(ItemComponent, Result.bStackable ? Result.TotalRoomToFill : 0, Result.Remainder);
+		Server_AddNewItem(ItemComponent);
 	}
 }
 
-void UInv_InventoryComponent::Server_AddNewItem_Implementation(UInv_ItemComponent* ItemComponent, int32 StackCount, int32 Remainder)
+void UInv_InventoryComponent::Server_AddNewItem_Implementation(UInv_ItemComponent* ItemComponent)
 {
+	if (!IsValid(ItemComponent)) return;
+
+	// 서버의 그리드 모델에서 배치 위치와 수량을 다시 계산합니다
+	// 아이템 생성 시 아이템 컴포넌트의 프래그먼트가 정리되므로 먼저 계산해야 합니다
+	const FInv_SlotAvailabilityResult Result = HasRoomForItem(ItemComponent);
+	if (Result.TotalRoomToFill == 0) return;
+
 	// 인벤토리 리스트에 새 아이템 엔트리 추가
 	UInv_InventoryItem* NewItem = InventoryList.AddEntry(ItemComponent);
-	NewItem->SetTotalStackCount(StackCount);
+	InventoryList.SetEntryStackCount(NewItem, Result.bStackable ? Result.TotalRoomToFill : 0);
+
+	// 서버의 그리드 모델에 배치합니다
+	if (FInv_GridModel* GridModel = FindGridModel(NewItem->GetItemManifest().GetItemCategory()))
+	{
+		GridModel->AddItem(NewItem, Result);
+		UpdateEntryGridStacks(NewItem);
+	}
 
 	// 리슨 서버나 스탠드얼론에서는 로컬에서도 델리게이트 호출
 	if (GetOwner()->GetNetMode() == NM_ListenServer || GetOwner()->GetNetMode() == NM_Standalone)
@@ -73,53 +103,70 @@ void UInv_InventoryComponent::Server_AddNewItem_Implementation(UInv_ItemComponen
 	}
 
 	// 남은 수량이 없으면 아이템 컴포넌트를 픽업 처리 (월드에서 제거)
-	if (Remainder == 0)
+	if (Result.Remainder == 0)
 	{
 		ItemComponent->PickedUp();
 	}
 	// 남은 수량이 있으면 아이템 컴포넌트의 스택 수량 업데이트
-	else if (FInv_StackableFragment* StackableFragment = ItemComponent->GetItemManifestMutable().GetFragmentOfTypeMutable<FInv_StackableFragment>())
+	else
 	{
-		StackableFragment->SetStackCount(Remainder);
+		ItemComponent->SetRemainingStackCount(Result.Remainder);
 	}
 }
 
-void UInv_InventoryComponent::Server_AddStacksToItem_Implementation(UInv_ItemComponent* ItemComponent, int32 StackCount,int32 Remainder)
+void UInv_InventoryComponent::Server_AddStacksToItem_Implementation(UInv_ItemComponent* ItemComponent)
 {
-	// 아이템 컴포넌트에서 아이템 타입 가져오기
-	const FGameplayTag& ItemType = IsValid(ItemComponent) ? ItemComponent->GetItemManifest().GetItemType() : FGameplayTag::EmptyTag;
+	// 클라이언트가 그리드 모델에 먼저 적용한 편집이므로 거부되더라도 처리한 것으로 셉니다
+	++AppliedGridEdits;
+	if (!IsValid(ItemComponent)) return;
 
 	// 인벤토리에서 해당 타입의 아이템 찾기
-	UInv_InventoryItem* Item = InventoryList.FindFirstItemByType(ItemType);
+	UInv_InventoryItem* Item = InventoryList.FindFirstItemByType(ItemComponent->GetItemManifest().GetItemType());
 	if (!IsValid(Item)) return;
 
+	// 서버의 그리드 모델에서 채울 수 있는 수량을 다시 계산합니다
+	FInv_SlotAvailabilityResult Result = HasRoomForItem(ItemComponent);
+	Result.Item = Item;
+	if (Result.TotalRoomToFill == 0) return;
+
+	ApplyStacksToGrid(Result);
+
 	// 기존 스택에 새로운 스택 수량 추가
-	Item->SetTotalStackCount(Item->GetTotalStackCount() + StackCount);
+	InventoryList.SetEntryStackCount(Item, Item->GetTotalStackCount() + Result.TotalRoomToFill);
 
-	if (Remainder == 0)
+	if (Result.Remainder == 0)
 	{
 		ItemComponent->PickedUp();
 	}
-	else if (FInv_StackableFragment* StackableFragment = ItemComponent->GetItemManifestMutable().GetFragmentOfTypeMutable<FInv_StackableFragment>())
+	else
 	{
-		StackableFragment->SetStackCount(Remainder);
+		ItemComponent->SetRemainingStackCount(Result.Remainder);
 	}
 }
 
 void UInv_InventoryComponent::Server_DropItem_Implementation(UInv_InventoryItem* Item, int32 StackCount)
 {
+	if (!OwnsItem(Item)) return;
+
+	// 그리드에 놓이지 않은(호버로 들고 있는) 수량만 드롭할 수 있습니다
+	if (!IsWithinUnplacedStackCount(Item, StackCount))
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Rejected dropping %d of %s: only %d are held outside the grid."), StackCount, *Item->GetItemManifest().GetItemType().ToString(), GetUnplacedStackCount(Item));
+		return;
+	}
+
 	// 드롭 후 남을 스택 수량을 계산합니다
 	const int32 NewStackCount = Item->GetTotalStackCount() - StackCount;
 	
 	// 모든 스택을 드롭하면 인벤토리에서 아이템을 완전히 제거합니다
 	if (NewStackCount <= 0)
 	{
-		InventoryList.RemoveEntry(Item);
+		RemoveItemFromInventory(Item);
 	}
 	else
 	{
 		// 일부만 드롭하면 남은 스택 수량을 업데이트합니다
-		Item->SetTotalStackCount(NewStackCount);
+		InventoryList.SetEntryStackCount(Item, NewStackCount);
 	}
 
 	SpawnDroppedItem(Item, StackCount);
@@ -127,18 +174,27 @@ void UInv_InventoryComponent::Server_DropItem_Implementation(UInv_InventoryItem*
 
 void UInv_InventoryComponent::Server_ConsumeItem_Implementation(UInv_InventoryItem* Item)
 {
+	if (!OwnsItem(Item)) return;
+
+	// 클라이언트는 그리드의 스택을 먼저 하나 줄이므로, 스택 가능 아이템은 그리드 밖에 하나 이상 남아 있어야 합니다
+	if (Item->IsStackable() && GetUnplacedStackCount(Item) < 1)
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Rejected consuming %s: every stack is still placed in the grid."), *Item->GetItemManifest().GetItemType().ToString());
+		return;
+	}
+
 	// 아이템의 스택 수량을 1 감소시킵니다
 	const int32 NewStackCount = Item->GetTotalStackCount() - 1;
 
 	// 스택이 0 이하가 되면 인벤토리에서 아이템을 완전히 제거합니다
 	if (NewStackCount <= 0)
 	{
-		InventoryList.RemoveEntry(Item);
+		RemoveItemFromInventory(Item);
 	}
 	else
 	{
 		// 스택이 남아있으면 새로운 수량으로 업데이트합니다
-		Item->SetTotalStackCount(NewStackCount);
+		InventoryList.SetEntryStackCount(Item, NewStackCount);
 	}
 
 	// 아이템의 소비 가능 프래그먼트를 찾아서 OnConsume을 호출합니다
@@ -161,6 +217,477 @@ void UInv_InventoryComponent::Multicast_EquipSlotClicked_Implementation(UInv_Inv
 	OnItemUnequipped.Broadcast(ItemToUnequip);
 }
 
+FInv_SlotAvailabilityResult UInv_InventoryComponent::HasRoomForItem(const UInv_ItemComponent* ItemComponent) const
+{
+	if (!IsValid(ItemComponent)) return FInv_SlotAvailabilityResult();
+
+	// 아이템 카테고리에 해당하는 그리드 모델에서 공간을 확인합니다
+	const FInv_ItemManifest& Manifest = ItemComponent->GetItemManifest();
+	const FInv_GridModel* GridModel = GridModels.Find(Manifest.GetItemCategory());
+	if (!GridModel)
+	{
+		UE_LOG(LogInventory, Error, TEXT("ItemComponent doesn't have a valid Item Category."));
+		return FInv_SlotAvailabilityResult();
+	}
+	return GridModel->HasRoomForItem(Manifest);
+}
+
+FInv_PlacementPlan UInv_InventoryComponent::PlanPlacement(TArrayView<const FInv_ItemManifest*> Manifests) const
+{
+	FInv_PlacementPlan Plan;
+	Plan.Results.SetNum(Manifests.Num());
+	Plan.Leftovers.SetNumZeroed(Manifests.Num());
+
+	// 카테고리별로 아이템을 나눠 각 그리드 모델에서 한 번씩 계획합니다
+	TMap<EInv_ItemCategory, TArray<int32>> IndicesByCategory;
+	for (int32 i = 0; i < Manifests.Num(); ++i)
+	{
+		if (!Manifests[i]) continue;
+		IndicesByCategory.FindOrAdd(Manifests[i]->GetItemCategory()).Add(i);
+	}
+
+	for (const auto& [Category, Indices] : IndicesByCategory)
+	{
+		const FInv_GridModel* GridModel = GridModels.Find(Category);
+
+		TArray<const FInv_ItemManifest*> CategoryManifests;
+		CategoryManifests.Reserve(Indices.Num());
+		for (const int32 Index : Indices)
+		{
+			CategoryManifests.Add(Manifests[Index]);
+		}
+
+		// 그리드가 없는 카테고리의 아이템은 전부 남은 수량으로 처리합니다
+		FInv_PlacementPlan CategoryPlan;
+		if (GridModel)
+		{
+			CategoryPlan = GridModel->PlanPlacement(CategoryManifests);
+		}
+
+		for (int32 i = 0; i < Indices.Num(); ++i)
+		{
+			const int32 Index = Indices[i];
+			if (GridModel)
+			{
+				Plan.Results[Index] = MoveTemp(CategoryPlan.Results[i]);
+				Plan.Leftovers[Index] = CategoryPlan.Leftovers[i];
+			}
+			else
+			{
+				Plan.Leftovers[Index] = FInv_GridModel::GetAmountToAdd(*Manifests[Index]);
+			}
+			Plan.TotalLeftover += Plan.Leftovers[Index];
+		}
+	}
+	return Plan;
+}
+
+const FInv_GridModel& UInv_InventoryComponent::GetGridModel(const EInv_ItemCategory Category) const
+{
+	static const FInv_GridModel EmptyGridModel;
+	const FInv_GridModel* GridModel = GridModels.Find(Category);
+	return GridModel ? *GridModel : EmptyGridModel;
+}
+
+void UInv_InventoryComponent::AddReplicatedItemToGrid(UInv_InventoryItem* Item, const TArray<FInv_GridStack>& GridStacks)
+{
+	if (!IsValid(Item)) return;
+
+	FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+	if (!GridModel) return;
+
+	// 배치 알고리즘을 다시 실행하지 않고 서버가 기록한 위치에 그대로 배치합니다
+	for (const FInv_GridStack& Stack : GridStacks)
+	{
+		if (GridModel->PlaceItem(Item, Stack.Index, Stack.StackCount, Stack.bRotated)) continue;
+
+		// 예측한 다른 배치가 자리를 차지하고 있으면 카테고리 전체를 엔트리대로 다시 배치합니다
+		RebuildGridModel(GridModel->GetItemCategory());
+		return;
+	}
+}
+
+void UInv_InventoryComponent::MarkGridItemForReconcile(UInv_InventoryItem* Item)
+{
+	if (GetOwner()->HasAuthority() || !IsValid(Item)) return;
+	GridItemsToReconcile.Add(Item);
+}
+
+void UInv_InventoryComponent::ReconcileGridItems()
+{
+	// 서버가 아직 처리하지 않은 편집이 있으면 엔트리가 예측보다 오래된 상태이므로 기다립니다
+	if (GetOwner()->HasAuthority() || SentGridEdits != AppliedGridEdits || GridItemsToReconcile.IsEmpty()) return;
+
+	// 서로 자리를 바꾼 아이템도 맞출 수 있도록 엔트리와 다른 아이템의 스택을 모두 뺀 뒤 다시 배치합니다
+	TArray<TPair<UInv_InventoryItem*, TArray<FInv_GridStack>>> MismatchedItems;
+	for (const TWeakObjectPtr<UInv_InventoryItem>& WeakItem : GridItemsToReconcile)
+	{
+		UInv_InventoryItem* Item = WeakItem.Get();
+		if (!IsValid(Item) || !Item->HasItemManifest()) continue;
+
+		FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+		if (!GridModel) continue;
+
+		// 엔트리가 제거된 아이템은 그리드에서도 빠져야 합니다
+		const TArray<FInv_GridStack>* EntryStacks = InventoryList.FindEntryGridStacks(Item);
+		TArray<FInv_GridStack> ServerStacks = EntryStacks ? *EntryStacks : TArray<FInv_GridStack>();
+		if (GridModel->GetItemStacks(Item) == ServerStacks) continue;
+
+		GridModel->RemoveItemStacks(Item);
+		MismatchedItems.Emplace(Item, MoveTemp(ServerStacks));
+	}
+	GridItemsToReconcile.Reset();
+
+	TSet<EInv_ItemCategory> ChangedCategories;
+	TSet<EInv_ItemCategory> CategoriesToRebuild;
+	for (const auto& [Item, ServerStacks] : MismatchedItems)
+	{
+		const EInv_ItemCategory Category = Item->GetItemManifest().GetItemCategory();
+		ChangedCategories.Add(Category);
+
+		FInv_GridModel* GridModel = FindGridModel(Category);
+		for (const FInv_GridStack& Stack : ServerStacks)
+		{
+			if (!GridModel->PlaceItem(Item, Stack.Index, Stack.StackCount, Stack.bRotated))
+			{
+				CategoriesToRebuild.Add(Category);
+			}
+		}
+	}
+
+	// 표시되지 않은 아이템이 서버와 다른 자리를 차지하고 있으면 카테고리 전체를 엔트리대로 다시 배치합니다
+	for (const EInv_ItemCategory Category : CategoriesToRebuild)
+	{
+		RebuildGridModel(Category);
+		ChangedCategories.Remove(Category);
+	}
+
+	// 로컬 컨트롤러라면 그리드 위젯이 새 배치를 표시하도록 알립니다
+	if (OwningController.IsValid() && OwningController->IsLocalController())
+	{
+		for (const EInv_ItemCategory Category : ChangedCategories)
+		{
+			OnGridRearranged.Broadcast(Category);
+		}
+	}
+}
+
+void UInv_InventoryComponent::HandleItemManifestReady(UInv_InventoryItem* Item)
+{
+	InventoryList.HandleItemManifestReady(Item);
+}
+
+void UInv_InventoryComponent::RequestItemDefinition(UInv_InventoryItem* Item)
+{
+	if (!IsValid(Item) || GetOwner()->HasAuthority()) return;
+
+	const FGameplayTag ItemType = Item->GetInstanceData().ItemType;
+	TArray<TWeakObjectPtr<UInv_InventoryItem>>& AwaitingItems = ItemsAwaitingDefinition.FindOrAdd(ItemType);
+	AwaitingItems.AddUnique(Item);
+	if (AwaitingItems.Num() == 1)
+	{
+		Server_RequestItemDefinition(ItemType);
+	}
+}
+
+void UInv_InventoryComponent::Server_RequestItemDefinition_Implementation(FGameplayTag ItemType)
+{
+	// 이 인벤토리에 있는 타입만, 타입마다 한 번만 응답합니다 (반복 요청으로 신뢰성 RPC를 쌓지 않도록)
+	if (!IsValid(InventoryList.FindFirstItemByType(ItemType))) return;
+	bool bAlreadySent = false;
+	SentItemDefinitions.Add(ItemType, &bAlreadySent);
+	if (bAlreadySent) return;
+
+	UInv_ItemDefinitionRegistry* Registry = UInv_ItemDefinitionRegistry::Get(this);
+	const FInv_ItemManifest* Definition = IsValid(Registry) ? Registry->FindDefinition(ItemType) : nullptr;
+	if (!Definition)
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Client requested an unknown item definition %s"), *ItemType.ToString());
+		return;
+	}
+	Client_ReceiveItemDefinition(*Definition);
+}
+
+void UInv_InventoryComponent::Client_ReceiveItemDefinition_Implementation(const FInv_ItemManifest& Definition)
+{
+	if (UInv_ItemDefinitionRegistry* Registry = UInv_ItemDefinitionRegistry::Get(this))
+	{
+		Registry->RegisterDefinition(Definition);
+	}
+
+	TArray<TWeakObjectPtr<UInv_InventoryItem>> AwaitingItems;
+	if (!ItemsAwaitingDefinition.RemoveAndCopyValue(Definition.GetItemType(), AwaitingItems)) return;
+
+	for (const TWeakObjectPtr<UInv_InventoryItem>& Item : AwaitingItems)
+	{
+		if (Item.IsValid())
+		{
+			Item->RebuildItemManifest();
+		}
+	}
+}
+
+FInv_SlotAvailabilityResult UInv_InventoryComponent::AddItemToGrid(UInv_InventoryItem* Item, const int32 StackCount)
+{
+	if (!IsValid(Item)) return FInv_SlotAvailabilityResult();
+
+	FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+	if (!GridModel) return FInv_SlotAvailabilityResult();
+
+	FInv_SlotAvailabilityResult Result = GridModel->HasRoomForItem(Item->GetItemManifest(), StackCount);
+	Result.Item = Item;
+	GridModel->AddItem(Item, Result);
+	UpdateEntryGridStacks(Item);
+
+	// 클라이언트라면 서버 모델에도 같은 연산을 요청합니다
+	if (!GetOwner()->HasAuthority())
+	{
+		RecordGridEdit(Item);
+		Server_AddItemToGrid(Item, StackCount);
+	}
+	return Result;
+}
+
+bool UInv_InventoryComponent::PlaceItemInGrid(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount, const bool bRotated)
+{
+	if (!IsValid(Item)) return false;
+
+	FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+	if (!GridModel || !GridModel->PlaceItem(Item, Index, StackCount, bRotated)) return false;
+	UpdateEntryGridStacks(Item);
+
+	if (!GetOwner()->HasAuthority())
+	{
+		RecordGridEdit(Item);
+		Server_PlaceItemInGrid(Item, Index, StackCount, bRotated);
+	}
+	return true;
+}
+
+void UInv_InventoryComponent::RemoveItemFromGrid(UInv_InventoryItem* Item, const int32 Index)
+{
+	if (!IsValid(Item)) return;
+
+	FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+	if (!GridModel || GridModel->GetItem(Index) != Item) return;
+
+	GridModel->RemoveItem(Index);
+	UpdateEntryGridStacks(Item);
+
+	if (!GetOwner()->HasAuthority())
+	{
+		RecordGridEdit(Item);
+		Server_RemoveItemFromGrid(Item, Index);
+	}
+}
+
+void UInv_InventoryComponent::SetGridStackCount(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount)
+{
+	if (!IsValid(Item)) return;
+
+	FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory());
+	if (!GridModel || GridModel->GetItem(Index) != Item) return;
+
+	GridModel->SetStackCount(Index, StackCount);
+	UpdateEntryGridStacks(Item);
+
+	if (!GetOwner()->HasAuthority())
+	{
+		RecordGridEdit(Item);
+		Server_SetGridStackCount(Item, Index, StackCount);
+	}
+}
+
+void UInv_InventoryComponent::Server_AddItemToGrid_Implementation(UInv_InventoryItem* Item, int32 StackCount)
+{
+	// 거부한 편집도 처리한 것으로 세어 클라이언트가 예측한 배치를 엔트리와 맞추게 합니다
+	++AppliedGridEdits;
+
+	// 이 인벤토리에 속한 아이템에 대해서만 서버 모델을 변경합니다
+	if (!OwnsItem(Item)) return;
+
+	// 그리드 밖에 있는 수량만 다시 추가할 수 있습니다 (엔트리의 전체 수량은 바뀌지 않음)
+	if (!IsWithinUnplacedStackCount(Item, StackCount))
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Rejected adding %d of %s to the grid: only %d are held outside the grid."), StackCount, *Item->GetItemManifest().GetItemType().ToString(), GetUnplacedStackCount(Item));
+		return;
+	}
+	AddItemToGrid(Item, StackCount);
+}
+
+void UInv_InventoryComponent::Server_PlaceItemInGrid_Implementation(UInv_InventoryItem* Item, int32 Index, int32 StackCount, bool bRotated)
+{
+	++AppliedGridEdits;
+	if (!OwnsItem(Item)) return;
+
+	// 스택 수량은 0 이상, 아이템의 최대 스택 크기 이하로 제한합니다
+	const FInv_StackableFragment* StackableFragment = Item->GetItemManifest().GetFragmentOfType<FInv_StackableFragment>();
+	const int32 MaxStackSize = StackableFragment ? StackableFragment->GetMaxStackSize() : 1;
+	StackCount = FMath::Clamp(StackCount, 0, MaxStackSize);
+
+	// 그리드 밖에 있는 수량만 놓을 수 있습니다 (엔트리의 전체 수량은 바뀌지 않음)
+	if (!IsWithinUnplacedStackCount(Item, StackCount))
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Rejected placing %d of %s at %d: only %d are held outside the grid."), StackCount, *Item->GetItemManifest().GetItemType().ToString(), Index, GetUnplacedStackCount(Item));
+		return;
+	}
+	// 회전할 수 없는 아이템의 회전 요청은 그리드 모델에서 무시됩니다
+	PlaceItemInGrid(Item, Index, StackCount, bRotated);
+}
+
+void UInv_InventoryComponent::Server_RemoveItemFromGrid_Implementation(UInv_InventoryItem* Item, int32 Index)
+{
+	++AppliedGridEdits;
+	if (!OwnsItem(Item)) return;
+	RemoveItemFromGrid(Item, Index);
+}
+
+void UInv_InventoryComponent::Server_SetGridStackCount_Implementation(UInv_InventoryItem* Item, int32 Index, int32 StackCount)
+{
+	++AppliedGridEdits;
+	if (!OwnsItem(Item)) return;
+
+	const FInv_StackableFragment* StackableFragment = Item->GetItemManifest().GetFragmentOfType<FInv_StackableFragment>();
+	const int32 MaxStackSize = StackableFragment ? StackableFragment->GetMaxStackSize() : 1;
+	StackCount = FMath::Clamp(StackCount, 0, MaxStackSize);
+
+	// 스택을 늘릴 때는 그리드 밖에 있는 수량에서만 옮겨 올 수 있습니다
+	const FInv_GridModel* GridModel = GridModels.Find(Item->GetItemManifest().GetItemCategory());
+	const int32 AddedStackCount = GridModel && GridModel->GetItem(Index) == Item ? StackCount - GridModel->GetStackCount(Index) : 0;
+	if (Item->IsStackable() && AddedStackCount > GetUnplacedStackCount(Item))
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Rejected raising the %s stack at %d to %d: only %d are held outside the grid."), *Item->GetItemManifest().GetItemType().ToString(), Index, StackCount, GetUnplacedStackCount(Item));
+		return;
+	}
+	SetGridStackCount(Item, Index, StackCount);
+}
+
+void UInv_InventoryComponent::TidyInventory()
+{
+	if (bTidyInProgress) return;
+
+	// 게임 스레드에서 카테고리별 스냅샷을 만들고, 각 카테고리를 워커 스레드에서 동시에 계산합니다
+	TArray<UE::Tasks::TTask<FInv_TidyResult>> SolveTasks;
+	for (const auto& [Category, GridModel] : GridModels)
+	{
+		if (GridModel.GetPlacements().IsEmpty()) continue;
+
+		SolveTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Solver = FInv_GridTidySolver(GridModel), TimeBudget = TidyTimeBudget]
+		{
+			return Solver.Solve(TimeBudget);
+		}));
+	}
+	if (SolveTasks.IsEmpty()) return;
+
+	bTidyInProgress = true;
+
+	// 모든 카테고리의 계산이 끝나면 결과를 모아 게임 스레드에서 한꺼번에 적용합니다
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis = TWeakObjectPtr<ThisClass>(this), SolveTasks]() mutable
+	{
+		TArray<FInv_TidyResult> Results;
+		Results.Reserve(SolveTasks.Num());
+		for (UE::Tasks::TTask<FInv_TidyResult>& SolveTask : SolveTasks)
+		{
+			Results.Add(MoveTemp(SolveTask.GetResult()));
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Results = MoveTemp(Results)]
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->ApplyTidyResults(Results);
+			}
+		});
+	}, SolveTasks);
+}
+
+void UInv_InventoryComponent::ApplyTidyResults(const TArray<FInv_TidyResult>& Results)
+{
+	bTidyInProgress = false;
+
+	TArray<FInv_GridMoveSet> MoveSets;
+	for (const FInv_TidyResult& Result : Results)
+	{
+		// 시간 안에 풀지 못했거나 이미 정리된 그리드는 건너뜁니다
+		if (!Result.bSolved || Result.Moves.IsEmpty()) continue;
+
+		// 계산하는 동안 아이템이 추가/이동된 그리드는 스냅샷과 달라졌으므로 건너뜁니다
+		const FInv_GridModel* GridModel = GridModels.Find(Result.Category);
+		if (!GridModel || GridModel->GetRevision() != Result.Revision) continue;
+
+		FInv_GridMoveSet& MoveSet = MoveSets.AddDefaulted_GetRef();
+		MoveSet.Category = Result.Category;
+		MoveSet.Moves = Result.Moves;
+	}
+	if (MoveSets.IsEmpty()) return;
+	if (!ApplyGridMoveSets(MoveSets)) return;
+
+	// 클라이언트라면 서버 모델에도 하나의 변경 묶음으로 전달합니다 (서버의 결과는 엔트리의 그리드 배치로 복제됨)
+	if (!GetOwner()->HasAuthority())
+	{
+		++SentGridEdits;
+		Server_ApplyGridMoveSets(MoveSets);
+	}
+}
+
+bool UInv_InventoryComponent::ApplyGridMoveSets(const TArray<FInv_GridMoveSet>& MoveSets)
+{
+	// 옮겨질 아이템을 이동 전 위치에서 찾아 둡니다
+	TArray<UInv_InventoryItem*> MovedItems;
+	for (const FInv_GridMoveSet& MoveSet : MoveSets)
+	{
+		if (const FInv_GridModel* GridModel = GridModels.Find(MoveSet.Category))
+		{
+			for (const FInv_GridMove& Move : MoveSet.Moves)
+			{
+				MovedItems.AddUnique(GridModel->GetItem(Move.FromIndex));
+			}
+		}
+	}
+
+	for (int32 i = 0; i < MoveSets.Num(); ++i)
+	{
+		FInv_GridModel* GridModel = FindGridModel(MoveSets[i].Category);
+		if (GridModel && GridModel->ApplyMoves(MoveSets[i].Moves)) continue;
+
+		// 하나라도 실패하면 이미 적용한 카테고리를 역방향 이동으로 되돌립니다
+		UE_LOG(LogInventory, Warning, TEXT("Failed to apply grid moves for category %s. Reverting the change set."), *UEnum::GetValueAsString(MoveSets[i].Category));
+		for (int32 j = 0; j < i; ++j)
+		{
+			TArray<FInv_GridMove> InverseMoves;
+			InverseMoves.Reserve(MoveSets[j].Moves.Num());
+			for (const FInv_GridMove& Move : MoveSets[j].Moves)
+			{
+				InverseMoves.Emplace(Move.ToIndex, Move.FromIndex);
+			}
+			FindGridModel(MoveSets[j].Category)->ApplyMoves(InverseMoves);
+		}
+		return false;
+	}
+
+	for (UInv_InventoryItem* Item : MovedItems)
+	{
+		UpdateEntryGridStacks(Item);
+		MarkGridItemForReconcile(Item);
+	}
+
+	// 로컬 컨트롤러라면 그리드 위젯이 새 배치를 표시하도록 알립니다
+	if (OwningController.IsValid() && OwningController->IsLocalController())
+	{
+		for (const FInv_GridMoveSet& MoveSet : MoveSets)
+		{
+			OnGridRearranged.Broadcast(MoveSet.Category);
+		}
+	}
+	return true;
+}
+
+void UInv_InventoryComponent::Server_ApplyGridMoveSets_Implementation(const TArray<FInv_GridMoveSet>& MoveSets)
+{
+	++AppliedGridEdits;
+	ApplyGridMoveSets(MoveSets);
+}
+
 void UInv_InventoryComponent::ToggleInventoryMenu()
 {
 	// 인벤토리 메뉴 열기/닫기 토글
@@ -224,13 +751,139 @@ void UInv_InventoryComponent::ConstructInventory()
 	OwningController = Cast<APlayerController>(GetOwner());
 	checkf(OwningController.IsValid(), TEXT("InventoryComponent must be attached to a PlayerController"));
 
+	// 그리드 모델은 서버와 로컬 클라이언트 모두에 필요합니다 (위젯보다 먼저 구성)
+	ConstructGridModels();
+
 	if (!OwningController->IsLocalController()) return;
 
+	// 메뉴 위젯만 만들고, 카테고리 그리드의 슬롯은 메뉴가 열려 탭이 처음 표시될 때 여러 프레임에 나누어 생성됩니다
 	InventoryMenu = CreateWidget<UInv_InventoryBase>(OwningController.Get(), InventoryMenuClass);
 	InventoryMenu->AddToViewport();
 	CloseInventoryMenu();
 }
 
+void UInv_InventoryComponent::ConstructGridModels()
+{
+	for (const EInv_ItemCategory Category : {EInv_ItemCategory::Equippable, EInv_ItemCategory::Consumable, EInv_ItemCategory::Craftable})
+	{
+		const FIntPoint* GridSize = GridSizes.Find(Category);
+		if (!GridSize)
+		{
+			UE_LOG(LogInventory, Warning, TEXT("InventoryComponent has no grid size for category %s."), *UEnum::GetValueAsString(Category));
+			continue;
+		}
+		GridModels.FindOrAdd(Category).Initialize(GridSize->Y, GridSize->X, Category);
+	}
+}
+
+FInv_GridModel* UInv_InventoryComponent::FindGridModel(const EInv_ItemCategory Category)
+{
+	return GridModels.Find(Category);
+}
+
+bool UInv_InventoryComponent::OwnsItem(const UInv_InventoryItem* Item) const
+{
+	return IsValid(Item) && InventoryList.ContainsItem(Item);
+}
+
+int32 UInv_InventoryComponent::GetUnplacedStackCount(const UInv_InventoryItem* Item) const
+{
+	const FInv_GridModel* GridModel = GridModels.Find(Item->GetItemManifest().GetItemCategory());
+	const TArray<FInv_GridStack> GridStacks = GridModel ? GridModel->GetItemStacks(Item) : TArray<FInv_GridStack>();
+
+	// 스택 불가능 아이템은 그리드에 한 번만 놓입니다
+	if (!Item->IsStackable()) return GridStacks.IsEmpty() ? 1 : 0;
+
+	int32 PlacedStackCount = 0;
+	for (const FInv_GridStack& Stack : GridStacks)
+	{
+		PlacedStackCount += Stack.StackCount;
+	}
+	return FMath::Max(Item->GetTotalStackCount() - PlacedStackCount, 0);
+}
+
+bool UInv_InventoryComponent::IsWithinUnplacedStackCount(const UInv_InventoryItem* Item, const int32 StackCount) const
+{
+	// 스택 불가능 아이템은 수량과 관계없이 그리드 밖에 있으면 됩니다
+	if (!Item->IsStackable()) return GetUnplacedStackCount(Item) > 0;
+	return StackCount > 0 && StackCount <= GetUnplacedStackCount(Item);
+}
+
+void UInv_InventoryComponent::RemoveItemFromInventory(UInv_InventoryItem* Item)
+{
+	// 클라이언트가 먼저 그리드에서 빼더라도 서버 모델에 남은 스택이 없도록 함께 제거합니다
+	if (FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory()))
+	{
+		GridModel->RemoveItemStacks(Item);
+	}
+	InventoryList.RemoveEntry(Item);
+}
+
+void UInv_InventoryComponent::ApplyStacksToGrid(const FInv_SlotAvailabilityResult& Result)
+{
+	UInv_InventoryItem* Item = Result.Item.Get();
+	if (!IsValid(Item)) return;
+
+	if (FInv_GridModel* GridModel = FindGridModel(Item->GetItemManifest().GetItemCategory()))
+	{
+		GridModel->AddItem(Item, Result);
+		UpdateEntryGridStacks(Item);
+	}
+
+	// 로컬 컨트롤러라면 그리드 위젯이 새 상태를 표시하도록 알립니다
+	if (OwningController.IsValid() && OwningController->IsLocalController())
+	{
+		OnStackChange.Broadcast(Result);
+	}
+}
+
+void UInv_InventoryComponent::UpdateEntryGridStacks(UInv_InventoryItem* Item)
+{
+	// 클라이언트는 배치 알고리즘을 다시 실행하지 않고 엔트리에 기록된 서버의 위치를 따릅니다
+	if (!GetOwner()->HasAuthority() || !IsValid(Item)) return;
+
+	if (const FInv_GridModel* GridModel = GridModels.Find(Item->GetItemManifest().GetItemCategory()))
+	{
+		InventoryList.SetEntryGridStacks(Item, GridModel->GetItemStacks(Item));
+	}
+}
+
+void UInv_InventoryComponent::RebuildGridModel(const EInv_ItemCategory Category)
+{
+	FInv_GridModel* GridModel = FindGridModel(Category);
+	if (!GridModel) return;
+
+	UE_LOG(LogInventory, Log, TEXT("Local grid for category %s diverged from the server. Rebuilding it from the inventory entries."), *UEnum::GetValueAsString(Category));
+	GridModel->Initialize(GridModel->GetRows(), GridModel->GetColumns(), Category);
+	for (const FInv_InventoryEntry& Entry : InventoryList.Entries)
+	{
+		// 아직 추가 처리되지 않은 엔트리는 처리될 때 배치됩니다
+		UInv_InventoryItem* Item = Entry.Item;
+		if (!InventoryList.ContainsItem(Item) || Item->GetItemManifest().GetItemCategory() != Category) continue;
+
+		for (const FInv_GridStack& Stack : Entry.GridStacks)
+		{
+			GridModel->PlaceItem(Item, Stack.Index, Stack.StackCount, Stack.bRotated);
+		}
+	}
+
+	if (OwningController.IsValid() && OwningController->IsLocalController())
+	{
+		OnGridRearranged.Broadcast(Category);
+	}
+}
+
+void UInv_InventoryComponent::RecordGridEdit(UInv_InventoryItem* Item)
+{
+	++SentGridEdits;
+	MarkGridItemForReconcile(Item);
+}
+
+void UInv_InventoryComponent::OnRep_AppliedGridEdits()
+{
+	ReconcileGridItems();
+}
+
 void UInv_InventoryComponent::OpenInventoryMenu()
 {
 	 if (!IsValid(InventoryMenu)) return;
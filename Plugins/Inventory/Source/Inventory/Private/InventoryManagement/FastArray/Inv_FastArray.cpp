@@ -20,22 +20,113 @@ TArray<UInv_InventoryItem*> FInv_InventoryFastArray::GetAllItems() const
 void FInv_InventoryFastArray::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
 {
 	UInv_InventoryComponent* IC = Cast<UInv_InventoryComponent>(OwnerComponent);
-	if (!IsValid(IC)) return;
 
+	// 추가 처리가 끝난(인덱스에 있는) 엔트리만 제거를 알립니다
 	for (int32 index : RemovedIndices)
 	{
-		IC->OnItemRemoved.Broadcast(Entries[index].Item);
+		UInv_InventoryItem* Item = Entries[index].Item;
+		if (!EntryIndexByItem.Contains(Item)) continue;
+
+		RemoveFromIndices(Item);
+		if (IsValid(IC))
+		{
+			// 엔트리가 사라진 아이템의 스택은 수신이 끝난 뒤 로컬 그리드 모델에서 제거됩니다
+			IC->MarkGridItemForReconcile(Item);
+			IC->OnItemRemoved.Broadcast(Item);
+		}
+	}
+
+	// 제거된 엔트리는 추가/변경 콜백이 끝난 뒤 큰 인덱스부터 RemoveAtSwap으로 지워집니다
+	// 그 전까지 Entries는 제거 전 위치를 유지하므로, 마지막 엔트리가 옮겨 들어올 자리만 기록해 두고 수신이 끝난 뒤 인덱스를 고칩니다
+	TArray<int32> SortedIndices(RemovedIndices.GetData(), RemovedIndices.Num());
+	SortedIndices.Sort();
+	int32 LastIndex = Entries.Num() - 1;
+	for (int32 i = SortedIndices.Num() - 1; i >= 0; --i)
+	{
+		const int32 RemovedIndex = SortedIndices[i];
+		if (RemovedIndex != LastIndex)
+		{
+			PendingMovedPositions.AddUnique(RemovedIndex);
+		}
+		PendingMovedPositions.Remove(LastIndex);
+		--LastIndex;
 	}
 }
 
 void FInv_InventoryFastArray::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	for (int32 index : AddedIndices)
+	{
+		HandleReplicatedAdd(index);
+	}
+}
+
+void FInv_InventoryFastArray::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
 {
 	UInv_InventoryComponent* IC = Cast<UInv_InventoryComponent>(OwnerComponent);
-	if (!IsValid(IC)) return;
 
-	for (int32 index : AddedIndices)
+	// 번들 하나에서 바뀐 엔트리들의 상태를 아이템에 반영하고, 그리드 배치는 PostReplicatedReceive에서 한 번에 맞춥니다
+	for (int32 index : ChangedIndices)
+	{
+		UInv_InventoryItem* Item = Entries[index].Item;
+		if (!IsValid(Item)) continue;
+
+		// 추가될 때 참조가 풀리지 않았던 아이템은 지금 추가된 것으로 처리합니다
+		// 매니페스트가 아직 복원되지 않은 아이템은 복원될 때 처리됩니다
+		if (HandleReplicatedAdd(index) || !EntryIndexByItem.Contains(Item)) continue;
+
+		Item->SetTotalStackCount(Entries[index].TotalStackCount);
+		if (IsValid(IC))
+		{
+			IC->MarkGridItemForReconcile(Item);
+		}
+	}
+}
+
+void FInv_InventoryFastArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// 제거가 끝나 엔트리가 최종 위치에 있으므로, 옮겨진 엔트리의 인덱스를 고칩니다
+	for (const int32 Position : PendingMovedPositions)
 	{
-		IC->OnItemAdded.Broadcast(Entries[index].Item);
+		if (!Entries.IsValidIndex(Position)) continue;
+		if (int32* EntryIndex = EntryIndexByItem.Find(Entries[Position].Item))
+		{
+			*EntryIndex = Position;
+		}
+	}
+	PendingMovedPositions.Reset();
+
+	if (UInv_InventoryComponent* IC = Cast<UInv_InventoryComponent>(OwnerComponent))
+	{
+		IC->ReconcileGridItems();
+	}
+}
+
+bool FInv_InventoryFastArray::HandleReplicatedAdd(const int32 EntryIndex)
+{
+	const FInv_InventoryEntry& Entry = Entries[EntryIndex];
+	UInv_InventoryItem* Item = Entry.Item;
+	if (!IsValid(Item) || !Item->HasItemManifest() || EntryIndexByItem.Contains(Item)) return false;
+
+	AddToIndices(EntryIndex);
+	Item->SetTotalStackCount(Entry.TotalStackCount);
+
+	UInv_InventoryComponent* IC = Cast<UInv_InventoryComponent>(OwnerComponent);
+	if (!IsValid(IC)) return true;
+
+	// 위젯이 표시하기 전에 로컬 그리드 모델의 서버와 같은 위치에 먼저 배치합니다
+	IC->AddReplicatedItemToGrid(Item, Entry.GridStacks);
+	IC->OnItemAdded.Broadcast(Item);
+	return true;
+}
+
+void FInv_InventoryFastArray::HandleItemManifestReady(UInv_InventoryItem* InItem)
+{
+	// 보류된 엔트리는 인덱스에 없으므로 엔트리를 직접 찾습니다 (아이템마다 한 번만 실행됨)
+	const int32 EntryIndex = Entries.IndexOfByPredicate([InItem](const FInv_InventoryEntry& Entry) { return Entry.Item == InItem; });
+	if (EntryIndex != INDEX_NONE)
+	{
+		HandleReplicatedAdd(EntryIndex);
 	}
 }
 
@@ -50,6 +141,7 @@ UInv_InventoryItem* FInv_InventoryFastArray::AddEntry(UInv_ItemComponent* InItem
 
 	FInv_InventoryEntry& NewEntry = Entries.AddDefaulted_GetRef();
 	NewEntry.Item = InItemComponent->GetItemManifest().Manifest(OwningActor);
+	AddToIndices(Entries.Num() - 1);
 
 	IC->AddRepSubObj(NewEntry.Item);
 	MarkItemDirty(NewEntry);
@@ -64,6 +156,7 @@ UInv_InventoryItem* FInv_InventoryFastArray::AddEntry(UInv_InventoryItem* InItem
 
 	FInv_InventoryEntry& NewEntry = Entries.AddDefaulted_GetRef();
 	NewEntry.Item = InItem;
+	AddToIndices(Entries.Num() - 1);
 
 	MarkItemDirty(NewEntry);
 	
@@ -73,24 +166,116 @@ UInv_InventoryItem* FInv_InventoryFastArray::AddEntry(UInv_InventoryItem* InItem
 
 void FInv_InventoryFastArray::RemoveEntry(UInv_InventoryItem* InItem)
 {
-	for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+	const int32 EntryIndex = FindEntryIndex(InItem);
+	if (EntryIndex == INDEX_NONE) return;
+
+	// 엔트리 순서는 복제에 의미가 없으므로 마지막 엔트리를 빈 자리로 옮기고 그 인덱스만 고칩니다
+	RemoveFromIndices(InItem);
+	Entries.RemoveAtSwap(EntryIndex);
+	if (Entries.IsValidIndex(EntryIndex))
 	{
-		FInv_InventoryEntry& Entry = *EntryIt;
-		if (Entry.Item == InItem)
-		{
-			EntryIt.RemoveCurrent();
-			MarkArrayDirty();
-		}
+		EntryIndexByItem.Add(Entries[EntryIndex].Item, EntryIndex);
 	}
+	MarkArrayDirty();
+}
+
+void FInv_InventoryFastArray::SetEntryGridStacks(UInv_InventoryItem* InItem, TArray<FInv_GridStack>&& GridStacks)
+{
+	const int32 EntryIndex = FindEntryIndex(InItem);
+	if (EntryIndex == INDEX_NONE) return;
+
+	FInv_InventoryEntry& Entry = Entries[EntryIndex];
+	if (Entry.GridStacks == GridStacks) return;
+
+	Entry.GridStacks = MoveTemp(GridStacks);
+	MarkItemDirty(Entry);
+}
+
+const TArray<FInv_GridStack>* FInv_InventoryFastArray::FindEntryGridStacks(const UInv_InventoryItem* InItem) const
+{
+	const int32 EntryIndex = FindEntryIndex(InItem);
+	return EntryIndex != INDEX_NONE ? &Entries[EntryIndex].GridStacks : nullptr;
+}
+
+void FInv_InventoryFastArray::SetEntryStackCount(UInv_InventoryItem* InItem, const int32 StackCount)
+{
+	const int32 EntryIndex = FindEntryIndex(InItem);
+	if (EntryIndex == INDEX_NONE) return;
+
+	// 서버의 아이템 값은 엔트리와 항상 같게 유지합니다
+	InItem->SetTotalStackCount(StackCount);
+
+	FInv_InventoryEntry& Entry = Entries[EntryIndex];
+	if (Entry.TotalStackCount == StackCount) return;
+
+	Entry.TotalStackCount = StackCount;
+	MarkItemDirty(Entry);
 }
 
 UInv_InventoryItem* FInv_InventoryFastArray::FindFirstItemByType(const FGameplayTag& ItemType)
 {
-	auto* FoundItem = Entries.FindByPredicate([ItemType = ItemType](const FInv_InventoryEntry& Entry)
+	const TArray<UInv_InventoryItem*>* Items = ItemsByType.Find(ItemType);
+	return Items && !Items->IsEmpty() ? (*Items)[0] : nullptr;
+}
+
+bool FInv_InventoryFastArray::ContainsItem(const UInv_InventoryItem* InItem) const
+{
+	return FindEntryIndex(InItem) != INDEX_NONE;
+}
+
+int32 FInv_InventoryFastArray::FindEntryIndex(const UInv_InventoryItem* InItem) const
+{
+	const int32* EntryIndex = EntryIndexByItem.Find(InItem);
+	if (!EntryIndex) return INDEX_NONE;
+	if (Entries.IsValidIndex(*EntryIndex) && Entries[*EntryIndex].Item == InItem) return *EntryIndex;
+
+	// 정상 경로에서는 일어나지 않지만, 인덱스가 엔트리와 어긋나 있으면 조용히 다시 만듭니다
+	RebuildIndices();
+	EntryIndex = EntryIndexByItem.Find(InItem);
+	return EntryIndex ? *EntryIndex : INDEX_NONE;
+}
+
+void FInv_InventoryFastArray::AddToIndices(const int32 EntryIndex) const
+{
+	UInv_InventoryItem* Item = Entries[EntryIndex].Item;
+	if (!IsValid(Item)) return;
+
+	if (int32* ExistingIndex = EntryIndexByItem.Find(Item))
 	{
-		return IsValid(Entry.Item) && Entry.Item->GetItemManifest().GetItemType().MatchesTagExact(ItemType);
-	});
-	return FoundItem ? FoundItem->Item : nullptr;
+		*ExistingIndex = EntryIndex;
+		return;
+	}
+	EntryIndexByItem.Add(Item, EntryIndex);
+	ItemsByType.FindOrAdd(Item->GetItemManifest().GetItemType()).Add(Item);
 }
 
+void FInv_InventoryFastArray::RemoveFromIndices(UInv_InventoryItem* InItem) const
+{
+	// 인덱스에 없던 아이템은 타입 목록에도 없습니다
+	if (EntryIndexByItem.Remove(InItem) == 0 || !IsValid(InItem)) return;
+
+	const FGameplayTag ItemType = InItem->GetItemManifest().GetItemType();
+	if (TArray<UInv_InventoryItem*>* Items = ItemsByType.Find(ItemType))
+	{
+		Items->RemoveSingle(InItem);
+		if (Items->IsEmpty())
+		{
+			ItemsByType.Remove(ItemType);
+		}
+	}
+}
 
+void FInv_InventoryFastArray::RebuildIndices() const
+{
+	// 아직 추가 처리되지 않은 엔트리가 인덱스에 들어가지 않도록 기존에 있던 아이템만 다시 넣습니다
+	TMap<const UInv_InventoryItem*, int32> PreviousIndices = MoveTemp(EntryIndexByItem);
+	EntryIndexByItem.Reset();
+	ItemsByType.Reset();
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		if (PreviousIndices.Contains(Entries[EntryIndex].Item))
+		{
+			AddToIndices(EntryIndex);
+		}
+	}
+}
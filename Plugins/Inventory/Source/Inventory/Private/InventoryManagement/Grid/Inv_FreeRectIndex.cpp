@@ -0,0 +1,204 @@
+#include "InventoryManagement/Grid/Inv_FreeRectIndex.h"
+
+#include "InventoryManagement/Grid/Inv_GridBitboard.h"
+
+namespace Inv_FreeRectIndex
+{
+	/** 두 사각형이 겹치는지 확인합니다 (Max는 포함하지 않음) */
+	FORCEINLINE bool Overlaps(const FIntRect& A, const FIntRect& B)
+	{
+		return A.Min.X < B.Max.X && B.Min.X < A.Max.X && A.Min.Y < B.Max.Y && B.Min.Y < A.Max.Y;
+	}
+
+	/** Outer가 Inner를 완전히 포함하는지 확인합니다 */
+	FORCEINLINE bool Contains(const FIntRect& Outer, const FIntRect& Inner)
+	{
+		return Outer.Min.X <= Inner.Min.X && Outer.Min.Y <= Inner.Min.Y && Outer.Max.X >= Inner.Max.X && Outer.Max.Y >= Inner.Max.Y;
+	}
+}
+
+void FInv_FreeRectIndex::Init(const int32 InRows, const int32 InColumns)
+{
+	Rows = FMath::Max(InRows, 0);
+	Columns = FMath::Max(InColumns, 0);
+
+	// 비어있는 그리드는 그리드 전체 크기의 사각형 하나입니다
+	FreeRects.Reset();
+	if (Rows > 0 && Columns > 0)
+	{
+		FreeRects.Emplace(0, 0, Columns, Rows);
+	}
+}
+
+void FInv_FreeRectIndex::Occupy(const FIntRect& Area)
+{
+	// 점유된 영역과 겹치는 사각형을 제거하고, 영역 바깥의 좌/우/상/하 조각으로 나눕니다
+	TArray<FIntRect> Pieces;
+	for (int32 i = FreeRects.Num() - 1; i >= 0; --i)
+	{
+		const FIntRect FreeRect = FreeRects[i];
+		if (!Inv_FreeRectIndex::Overlaps(FreeRect, Area)) continue;
+
+		FreeRects.RemoveAt(i, EAllowShrinking::No);
+		if (Area.Min.X > FreeRect.Min.X) Pieces.Emplace(FreeRect.Min.X, FreeRect.Min.Y, Area.Min.X, FreeRect.Max.Y);
+		if (Area.Max.X < FreeRect.Max.X) Pieces.Emplace(Area.Max.X, FreeRect.Min.Y, FreeRect.Max.X, FreeRect.Max.Y);
+		if (Area.Min.Y > FreeRect.Min.Y) Pieces.Emplace(FreeRect.Min.X, FreeRect.Min.Y, FreeRect.Max.X, Area.Min.Y);
+		if (Area.Max.Y < FreeRect.Max.Y) Pieces.Emplace(FreeRect.Min.X, Area.Max.Y, FreeRect.Max.X, FreeRect.Max.Y);
+	}
+	if (Pieces.IsEmpty()) return;
+
+	// 다른 사각형에 포함되는 조각은 최대 사각형이 아니므로 버립니다 (같은 조각은 하나만 남김)
+	const int32 NumUntouched = FreeRects.Num();
+	for (int32 i = 0; i < Pieces.Num(); ++i)
+	{
+		const FIntRect& Piece = Pieces[i];
+		bool bContained = false;
+		for (int32 j = 0; j < NumUntouched && !bContained; ++j)
+		{
+			bContained = Inv_FreeRectIndex::Contains(FreeRects[j], Piece);
+		}
+		for (int32 j = 0; j < Pieces.Num() && !bContained; ++j)
+		{
+			if (i == j || !Inv_FreeRectIndex::Contains(Pieces[j], Piece)) continue;
+			bContained = Pieces[j] != Piece || j < i;
+		}
+		if (!bContained)
+		{
+			FreeRects.Add(Piece);
+		}
+	}
+	SortFreeRects();
+}
+
+void FInv_FreeRectIndex::Release(const FIntRect& Area, const FInv_GridBitboard& Occupancy)
+{
+	const int32 WordsPerRow = Occupancy.GetWordsPerRow();
+	TArray<uint64, TInlineAllocator<4>> Band;
+	Band.SetNumUninitialized(WordsPerRow);
+
+	auto IsFree = [&Band](const int32 Column)
+	{
+		return ((Band[Column / 64] >> (Column % 64)) & 1) == 0;
+	};
+	auto AddRow = [&Band, &Occupancy, WordsPerRow](const int32 Row)
+	{
+		const uint64* RowWords = Occupancy.GetRowWords(Row);
+		for (int32 Word = 0; Word < WordsPerRow; ++Word)
+		{
+			Band[Word] |= RowWords[Word];
+		}
+	};
+	auto HasFreeInArea = [&IsFree, &Area]()
+	{
+		for (int32 Column = Area.Min.X; Column < Area.Max.X; ++Column)
+		{
+			if (IsFree(Column)) return true;
+		}
+		return false;
+	};
+
+	// 새로 생기는 최대 빈 사각형은 반드시 비워진 영역과 겹칩니다
+	// 영역과 겹치는 모든 행 구간 [Top, Bottom]에 대해, 구간 전체에서 비어있는 열들 중 영역과 겹치는 최대 구간을 찾고
+	// 위아래로 더 늘릴 수 없는 것만 새 사각형으로 추가합니다
+	TArray<FIntRect> NewRects;
+	for (int32 Top = Area.Max.Y - 1; Top >= 0; --Top)
+	{
+		const int32 FirstBottom = FMath::Max(Top, Area.Min.Y);
+		FMemory::Memzero(Band.GetData(), WordsPerRow * sizeof(uint64));
+		for (int32 Row = Top; Row <= FirstBottom; ++Row)
+		{
+			AddRow(Row);
+		}
+
+		// 비워진 영역의 셀은 모두 비어있으므로 이 검사는 Top이 영역 위로 올라간 뒤에만 실패하며,
+		// 그 이후로는 Top이 올라갈수록 구간이 좁아지기만 하므로 검색을 끝냅니다
+		if (!HasFreeInArea()) break;
+
+		for (int32 Bottom = FirstBottom; Bottom < Rows; ++Bottom)
+		{
+			if (Bottom > FirstBottom)
+			{
+				AddRow(Bottom);
+				if (!HasFreeInArea()) break;
+			}
+
+			for (int32 Column = Area.Min.X; Column < Area.Max.X; )
+			{
+				if (!IsFree(Column))
+				{
+					++Column;
+					continue;
+				}
+
+				// 이 열을 포함하는 비어있는 최대 열 구간 [Left, Right)
+				int32 Left = Column;
+				while (Left > 0 && IsFree(Left - 1)) --Left;
+				int32 Right = Column + 1;
+				while (Right < Columns && IsFree(Right)) ++Right;
+				Column = Right;
+
+				const bool bBlockedAbove = Top == 0 || !Occupancy.IsRectClear(Left, Top - 1, Right - Left, 1);
+				const bool bBlockedBelow = Bottom == Rows - 1 || !Occupancy.IsRectClear(Left, Bottom + 1, Right - Left, 1);
+				if (bBlockedAbove && bBlockedBelow)
+				{
+					NewRects.Emplace(Left, Top, Right, Bottom + 1);
+				}
+			}
+		}
+	}
+	if (NewRects.IsEmpty()) return;
+
+	// 새 사각형에 포함되는 기존 사각형은 더 이상 최대 사각형이 아닙니다
+	FreeRects.RemoveAll([&NewRects](const FIntRect& FreeRect)
+	{
+		return NewRects.ContainsByPredicate([&FreeRect](const FIntRect& NewRect)
+		{
+			return Inv_FreeRectIndex::Contains(NewRect, FreeRect);
+		});
+	});
+	FreeRects.Append(NewRects);
+	SortFreeRects();
+}
+
+int32 FInv_FreeRectIndex::FindFirstFit(const FIntPoint& Dimensions, const int32 FromIndex) const
+{
+	int32 BestIndex = INDEX_NONE;
+	for (const FIntRect& FreeRect : FreeRects)
+	{
+		// 사각형 안의 어떤 위치도 좌상단보다 앞설 수 없으므로, 더 나은 후보가 나올 수 없으면 멈춥니다
+		if (BestIndex != INDEX_NONE && ToIndex(FreeRect.Min) >= BestIndex) break;
+		if (FreeRect.Width() < Dimensions.X || FreeRect.Height() < Dimensions.Y) continue;
+
+		const int32 Candidate = FindFirstFitInRect(FreeRect, Dimensions, FromIndex);
+		if (Candidate != INDEX_NONE && (BestIndex == INDEX_NONE || Candidate < BestIndex))
+		{
+			BestIndex = Candidate;
+		}
+	}
+	return BestIndex;
+}
+
+int32 FInv_FreeRectIndex::FindFirstFitInRect(const FIntRect& FreeRect, const FIntPoint& Dimensions, const int32 FromIndex) const
+{
+	// 사각형 안에서 아이템의 좌상단이 놓일 수 있는 범위
+	const int32 LastColumn = FreeRect.Max.X - Dimensions.X;
+	const int32 LastRow = FreeRect.Max.Y - Dimensions.Y;
+
+	const int32 FromColumn = FromIndex % Columns;
+	const int32 FromRow = FromIndex / Columns;
+
+	if (FromRow < FreeRect.Min.Y) return ToIndex(FreeRect.Min);
+	if (FromRow > LastRow) return INDEX_NONE;
+	if (FromColumn <= FreeRect.Min.X) return ToIndex(FIntPoint(FreeRect.Min.X, FromRow));
+	if (FromColumn <= LastColumn) return FromIndex;
+	if (FromRow < LastRow) return ToIndex(FIntPoint(FreeRect.Min.X, FromRow + 1));
+	return INDEX_NONE;
+}
+
+void FInv_FreeRectIndex::SortFreeRects()
+{
+	FreeRects.Sort([this](const FIntRect& A, const FIntRect& B)
+	{
+		return ToIndex(A.Min) < ToIndex(B.Min);
+	});
+}
@@ -0,0 +1,100 @@
+#include "InventoryManagement/Grid/Inv_GridBitboard.h"
+
+namespace Inv_GridBitboard
+{
+	constexpr int32 BitsPerWord = 64;
+
+	/** 워드 안의 [Low, High) 비트만 1인 마스크를 만듭니다 (0 <= Low < High <= 64) */
+	FORCEINLINE uint64 MakeMask(const int32 Low, const int32 High)
+	{
+		const int32 Count = High - Low;
+		const uint64 Bits = Count == BitsPerWord ? ~uint64(0) : ((uint64(1) << Count) - 1);
+		return Bits << Low;
+	}
+}
+
+void FInv_GridBitboard::Init(const int32 InRows, const int32 InColumns)
+{
+	Rows = FMath::Max(InRows, 0);
+	Columns = FMath::Max(InColumns, 0);
+	WordsPerRow = FMath::DivideAndRoundUp(Columns, Inv_GridBitboard::BitsPerWord);
+	Words.Init(0, Rows * WordsPerRow);
+}
+
+void FInv_GridBitboard::Reset()
+{
+	FMemory::Memzero(Words.GetData(), Words.Num() * sizeof(uint64));
+}
+
+bool FInv_GridBitboard::IsSet(const int32 Column, const int32 Row) const
+{
+	const uint64 Word = Words[Row * WordsPerRow + Column / Inv_GridBitboard::BitsPerWord];
+	return (Word >> (Column % Inv_GridBitboard::BitsPerWord)) & 1;
+}
+
+template<typename FuncT>
+bool FInv_GridBitboard::ForEachRowWord(const int32 Row, const int32 Column, const int32 Width, FuncT&& Func) const
+{
+	// 구간이 걸치는 워드마다 해당 부분만 1인 마스크를 만들어 전달합니다
+	const int32 End = Column + Width;
+	const int32 RowStart = Row * WordsPerRow;
+	for (int32 WordIndex = Column / Inv_GridBitboard::BitsPerWord; WordIndex * Inv_GridBitboard::BitsPerWord < End; ++WordIndex)
+	{
+		const int32 WordBegin = WordIndex * Inv_GridBitboard::BitsPerWord;
+		const int32 Low = FMath::Max(Column, WordBegin) - WordBegin;
+		const int32 High = FMath::Min(End, WordBegin + Inv_GridBitboard::BitsPerWord) - WordBegin;
+		if (!Func(RowStart + WordIndex, Inv_GridBitboard::MakeMask(Low, High))) return false;
+	}
+	return true;
+}
+
+bool FInv_GridBitboard::IsRectClear(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const
+{
+	check(Column >= 0 && Row >= 0 && Column + Width <= Columns && Row + Height <= Rows);
+	if (Width <= 0) return true;
+
+	// 구간이 한 워드 안에 있으면 마스크는 모든 행에서 같으므로 행마다 AND 한 번으로 확인합니다
+	const int32 FirstWord = Column / Inv_GridBitboard::BitsPerWord;
+	if (FirstWord == (Column + Width - 1) / Inv_GridBitboard::BitsPerWord)
+	{
+		const int32 Low = Column - FirstWord * Inv_GridBitboard::BitsPerWord;
+		const uint64 Mask = Inv_GridBitboard::MakeMask(Low, Low + Width);
+		const uint64* Word = Words.GetData() + Row * WordsPerRow + FirstWord;
+		for (int32 RowOffset = 0; RowOffset < Height; ++RowOffset, Word += WordsPerRow)
+		{
+			if (*Word & Mask) return false;
+		}
+		return true;
+	}
+
+	for (int32 RowOffset = 0; RowOffset < Height; ++RowOffset)
+	{
+		const bool bRowClear = ForEachRowWord(Row + RowOffset, Column, Width, [this](const int32 WordIndex, const uint64 Mask)
+		{
+			return (Words[WordIndex] & Mask) == 0;
+		});
+		if (!bRowClear) return false;
+	}
+	return true;
+}
+
+void FInv_GridBitboard::SetRect(const int32 Column, const int32 Row, const int32 Width, const int32 Height, const bool bValue)
+{
+	check(Column >= 0 && Row >= 0 && Column + Width <= Columns && Row + Height <= Rows);
+
+	for (int32 RowOffset = 0; RowOffset < Height; ++RowOffset)
+	{
+		ForEachRowWord(Row + RowOffset, Column, Width, [this, bValue](const int32 WordIndex, const uint64 Mask)
+		{
+			if (bValue)
+			{
+				Words[WordIndex] |= Mask;
+			}
+			else
+			{
+				Words[WordIndex] &= ~Mask;
+			}
+			return true;
+		});
+	}
+}
@@ -0,0 +1,459 @@
+#include "InventoryManagement/Grid/Inv_GridModel.h"
+
+#include "Algo/BinarySearch.h"
+#include "Items/Inv_InventoryItem.h"
+#include "Items/Fragments/Inv_ItemFragment.h"
+#include "Items/Manifest/Inv_ItemManifest.h"
+
+void FInv_GridModel::Initialize(const int32 InRows, const int32 InColumns, const EInv_ItemCategory InItemCategory)
+{
+	Rows = FMath::Max(InRows, 0);
+	Columns = FMath::Max(InColumns, 0);
+	ItemCategory = InItemCategory;
+
+	// 모든 셀을 비어있는 상태로 초기화합니다
+	UpperLeftIndices.Init(INDEX_NONE, Rows * Columns);
+	Occupancy.Init(Rows, Columns);
+	FreeRects.Init(Rows, Columns);
+	SummedArea.Init(Rows, Columns);
+	Placements.Reset();
+	PartialStacksByType.Reset();
+	++Revision;
+}
+
+FInv_SlotAvailabilityResult FInv_GridModel::HasRoomForItem(const FInv_ItemManifest& Manifest, const int32 StackAmountOverride, const EInv_ItemOrientation Orientation) const
+{
+	FInv_SlotAvailabilityResult Result;
+
+	// 아이템이 스택 가능한지 확인합니다
+	const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>();
+	Result.bStackable = StackableFragment != nullptr;
+
+	// 스택 크기 정보를 초기화합니다
+	// - MaxStackSize: 한 슬롯에 쌓을 수 있는 최대 개수
+	// - AmountToFill: 그리드에 추가하려는 아이템의 총 개수
+	const int32 MaxStackSize = StackableFragment ? StackableFragment->GetMaxStackSize() : 1;
+	int32 AmountToFill = StackableFragment ? StackableFragment->GetStackCount() : 1;
+	if (StackAmountOverride != -1 && Result.bStackable)
+	{
+		AmountToFill = StackAmountOverride;
+	}
+
+	const FGameplayTag ItemType = Manifest.GetItemType();
+
+	// 새 스택에 사용할 수 있는 방향 (회전할 수 없는 아이템은 원래 방향만)
+	const bool bCanRotate = CanRotate(Manifest);
+	const bool bTryUpright = !bCanRotate || Orientation != EInv_ItemOrientation::Rotated;
+	const bool bTryRotated = bCanRotate && Orientation != EInv_ItemOrientation::Upright;
+	const FIntPoint UprightDimensions = GetItemDimensions(Manifest, false);
+	const FIntPoint RotatedDimensions = GetItemDimensions(Manifest, true);
+
+	// 이번 검사에서 이미 다른 스택에 할당된 셀들
+	FInv_GridBitboard Claimed;
+	Claimed.Init(Rows, Columns);
+
+	// 방향별로 할당되지 않은 다음 빈 위치를 기억해 둡니다
+	// 빈 사각형은 검사 중에 바뀌지 않고 할당된 셀은 늘어나기만 하므로, 위치가 사용되었거나 할당된 셀과 겹치게 된 경우에만 그 뒤에서 다시 찾습니다
+	// 따라서 두 방향 모두 그리드를 한 번씩만 앞으로 훑습니다
+	auto AdvanceFreeIndex = [this, &Claimed](int32& FreeIndex, const FIntPoint& Size, const int32 From)
+	{
+		if (FreeIndex == INDEX_NONE) return;
+		if (FreeIndex < From)
+		{
+			FreeIndex = FreeRects.FindFirstFit(Size, From);
+		}
+		while (FreeIndex != INDEX_NONE && !Claimed.IsRectClear(FreeIndex % Columns, FreeIndex / Columns, Size.X, Size.Y))
+		{
+			FreeIndex = FreeRects.FindFirstFit(Size, FreeIndex + 1);
+		}
+	};
+	int32 UprightFreeIndex = bTryUpright ? FreeRects.FindFirstFit(UprightDimensions) : INDEX_NONE;
+	int32 RotatedFreeIndex = bTryRotated ? FreeRects.FindFirstFit(RotatedDimensions) : INDEX_NONE;
+
+	// 같은 타입의 가득 차지 않은 스택들 (좌상단 인덱스 순으로 유지되는 인덱스)
+	const TArray<int32>* FoundPartialStacks = Result.bStackable ? PartialStacksByType.Find(ItemType) : nullptr;
+	const TArrayView<const int32> PartialStacks = FoundPartialStacks ? TArrayView<const int32>(*FoundPartialStacks) : TArrayView<const int32>();
+
+	// 행 우선 순서의 첫 번째 맞는 위치를 반복해서 찾습니다
+	// 후보는 채울 수 있는 기존 스택과 방향별로 빈 사각형 인덱스가 찾아준 빈 위치이며, 가장 앞선 쪽을 사용합니다
+	int32 SearchFrom = 0;
+	int32 StackCursor = 0;
+	while (AmountToFill > 0)
+	{
+		// 다음으로 채울 수 있는 기존 스택 (스택은 배치된 방향 그대로 채웁니다)
+		// 할당된 셀은 늘어나기만 하므로 한 번 실패한 스택은 다시 확인할 필요가 없습니다
+		int32 StackIndex = INDEX_NONE;
+		for (; StackCursor < PartialStacks.Num(); ++StackCursor)
+		{
+			const int32 Candidate = PartialStacks[StackCursor];
+			if (Candidate < SearchFrom) continue;
+			const FInv_GridPlacement& Stack = Placements.FindChecked(Candidate);
+			if (Stack.StackCount >= MaxStackSize) continue;
+			if (!HasRoomAtIndex(Candidate, Stack.Dimensions, Claimed, ItemType, MaxStackSize)) continue;
+
+			StackIndex = Candidate;
+			break;
+		}
+
+		// 방향별로 이번 검사에서 할당되지 않은 다음 빈 위치 (같은 위치라면 원래 방향을 우선)
+		AdvanceFreeIndex(UprightFreeIndex, UprightDimensions, SearchFrom);
+		AdvanceFreeIndex(RotatedFreeIndex, RotatedDimensions, SearchFrom);
+		const bool bRotated = RotatedFreeIndex != INDEX_NONE && (UprightFreeIndex == INDEX_NONE || RotatedFreeIndex < UprightFreeIndex);
+		const int32 FreeIndex = bRotated ? RotatedFreeIndex : UprightFreeIndex;
+
+		// 더 이상 배치할 위치가 없으면 검색 종료
+		if (StackIndex == INDEX_NONE && FreeIndex == INDEX_NONE) break;
+
+		const bool bItemAtIndex = StackIndex != INDEX_NONE && (FreeIndex == INDEX_NONE || StackIndex < FreeIndex);
+		const int32 Index = bItemAtIndex ? StackIndex : FreeIndex;
+		const FIntPoint Dimensions = bItemAtIndex ? Placements.FindChecked(Index).Dimensions : (bRotated ? RotatedDimensions : UprightDimensions);
+		SearchFrom = Index + 1;
+
+		// 이 위치에 이미 같은 타입의 스택이 있다면 그 스택의 남은 공간만큼 채울 수 있습니다
+		const int32 RoomInSlot = MaxStackSize - (bItemAtIndex ? Placements.FindChecked(Index).StackCount : 0);
+		const int32 AmountToFillInSlot = Result.bStackable ? FMath::Min(AmountToFill, RoomInSlot) : 1;
+		if (AmountToFillInSlot <= 0) continue;
+
+		// 아이템이 차지할 셀들을 할당된 것으로 표시합니다
+		Claimed.SetRect(Index % Columns, Index / Columns, Dimensions.X, Dimensions.Y, true);
+
+		Result.TotalRoomToFill += AmountToFillInSlot;
+		Result.SlotAvailabilities.Emplace(
+			FInv_SlotAvailability{
+				Index,
+				// 스택 가능한 경우만 수량 정보 저장
+				Result.bStackable ? AmountToFillInSlot : 0,
+				bItemAtIndex,
+				!bItemAtIndex && bRotated
+			}
+		);
+
+		AmountToFill -= AmountToFillInSlot;
+		Result.Remainder = AmountToFill;
+	}
+	return Result;
+}
+
+bool FInv_GridModel::HasRoomAtIndex(const int32 Index, const FIntPoint& Dimensions, const FInv_GridBitboard& Claimed, const FGameplayTag& ItemType, const int32 MaxStackSize) const
+{
+	const int32 Column = Index % Columns;
+	const int32 Row = Index / Columns;
+
+	// 이미 다른 스택에 할당된 셀이 있으면 사용 불가
+	if (!Claimed.IsRectClear(Column, Row, Dimensions.X, Dimensions.Y)) return false;
+
+	// 영역이 모두 비어있으면 배치 가능
+	if (SummedArea.IsRectEmpty(Column, Row, Dimensions.X, Dimensions.Y)) return true;
+
+	// 그렇지 않다면 이 위치에서 시작하는 같은 타입의 가득 차지 않은 스택만 겹칠 수 있습니다
+	if (UpperLeftIndices[Index] != Index) return false;
+
+	const FInv_GridPlacement& Placement = Placements.FindChecked(Index);
+	if (!Placement.bStackable) return false;
+	if (!Placement.ItemType.MatchesTagExact(ItemType)) return false;
+	if (Placement.StackCount >= MaxStackSize) return false;
+
+	// 스택이 차지하지 않는 나머지 영역은 비어있어야 합니다
+	const int32 OverlapWidth = FMath::Min(Placement.Dimensions.X, Dimensions.X);
+	const int32 OverlapHeight = FMath::Min(Placement.Dimensions.Y, Dimensions.Y);
+	if (!SummedArea.IsRectEmpty(Column + OverlapWidth, Row, Dimensions.X - OverlapWidth, OverlapHeight)) return false;
+	return SummedArea.IsRectEmpty(Column, Row + OverlapHeight, Dimensions.X, Dimensions.Y - OverlapHeight);
+}
+
+FInv_SpaceQueryResult FInv_GridModel::CheckHoverPosition(const FIntPoint& Position, const FIntPoint& Dimensions) const
+{
+	FInv_SpaceQueryResult Result;
+
+	// 그리드 경계 내에 있는지 확인
+	const int32 StartIndex = Position.X + Position.Y * Columns;
+	if (!IsInGridBounds(StartIndex, Dimensions)) return Result;
+
+	// 영역과 겹치는 아이템 수를 누적 합 테이블에서 바로 계산합니다
+	const int32 NumItems = SummedArea.CountItems(Position.X, Position.Y, Dimensions.X, Dimensions.Y);
+	Result.bHasSpace = NumItems == 0;
+
+	// 정확히 하나의 아이템만 겹치는 경우에만 교환할 수 있습니다
+	if (NumItems == 1)
+	{
+		const int32 OccupiedIndex = SummedArea.FindFirstOccupied(Position.X, Position.Y, Dimensions.X, Dimensions.Y);
+		Result.UpperLeftIndex = UpperLeftIndices[OccupiedIndex];
+		Result.ValidItem = Placements.FindChecked(Result.UpperLeftIndex).Item;
+	}
+	return Result;
+}
+
+bool FInv_GridModel::IsInGridBounds(const int32 StartIndex, const FIntPoint& ItemDimensions) const
+{
+	// 시작 인덱스가 유효한 범위 내에 있는지 확인
+	if (StartIndex < 0 || StartIndex >= Num()) return false;
+
+	// 아이템의 끝 위치가 그리드 경계를 넘지 않는지 확인
+	const int32 EndColumn = (StartIndex % Columns) + ItemDimensions.X;
+	const int32 EndRow = (StartIndex / Columns) + ItemDimensions.Y;
+	return EndColumn <= Columns && EndRow <= Rows;
+}
+
+bool FInv_GridModel::IsAreaEmpty(const int32 Index, const FIntPoint& Dimensions) const
+{
+	if (!IsInGridBounds(Index, Dimensions)) return false;
+
+	return SummedArea.IsRectEmpty(Index % Columns, Index / Columns, Dimensions.X, Dimensions.Y);
+}
+
+void FInv_GridModel::AddItem(UInv_InventoryItem* Item, const FInv_SlotAvailabilityResult& Result)
+{
+	if (!IsValid(Item)) return;
+	ApplyResult(Item, Item->GetItemManifest(), Result);
+}
+
+bool FInv_GridModel::PlaceItem(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount, const bool bRotated)
+{
+	if (!IsValid(Item)) return false;
+	return PlaceManifest(Item, Item->GetItemManifest(), Index, StackCount, bRotated);
+}
+
+FInv_PlacementPlan FInv_GridModel::PlanPlacement(TArrayView<const FInv_ItemManifest*> Manifests) const
+{
+	FInv_PlacementPlan Plan;
+	Plan.Results.Reserve(Manifests.Num());
+	Plan.Leftovers.Reserve(Manifests.Num());
+
+	// 실제 모델은 그대로 두고, 복사본에 앞선 아이템들의 배치를 누적하며 계획합니다
+	FInv_GridModel Scratch = *this;
+	for (const FInv_ItemManifest* Manifest : Manifests)
+	{
+		FInv_SlotAvailabilityResult& Result = Plan.Results.AddDefaulted_GetRef();
+		int32& Leftover = Plan.Leftovers.AddZeroed_GetRef();
+		if (!Manifest) continue;
+
+		Result = Scratch.HasRoomForItem(*Manifest);
+		Scratch.ApplyResult(nullptr, *Manifest, Result);
+
+		// 스택 불가능 아이템은 슬롯 하나에 한 개씩 배치됩니다
+		const int32 AmountPlaced = Result.bStackable ? Result.TotalRoomToFill : Result.SlotAvailabilities.Num();
+		Leftover = GetAmountToAdd(*Manifest) - AmountPlaced;
+		Plan.TotalLeftover += Leftover;
+	}
+	return Plan;
+}
+
+void FInv_GridModel::ApplyResult(UInv_InventoryItem* Item, const FInv_ItemManifest& Manifest, const FInv_SlotAvailabilityResult& Result)
+{
+	for (const FInv_SlotAvailability& Availability : Result.SlotAvailabilities)
+	{
+		// 이미 스택이 있는 위치면 수량만 더합니다
+		if (Availability.bItemAtIndex)
+		{
+			if (FInv_GridPlacement* Placement = Placements.Find(Availability.Index))
+			{
+				Placement->StackCount += Availability.AmountToFill;
+				UpdatePartialStackIndex(Availability.Index, *Placement);
+			}
+			continue;
+		}
+
+		// 비어있는 위치면 새 스택을 배치합니다
+		PlaceManifest(Item, Manifest, Availability.Index, Availability.AmountToFill, Availability.bRotated);
+	}
+}
+
+bool FInv_GridModel::PlaceManifest(UInv_InventoryItem* Item, const FInv_ItemManifest& Manifest, const int32 Index, const int32 StackCount, const bool bRotated)
+{
+	// 배치 검사에 필요한 값들을 매니페스트에서 복사해 둡니다
+	const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>();
+
+	FInv_GridPlacement Placement;
+	Placement.Item = Item;
+	Placement.ItemType = Manifest.GetItemType();
+	Placement.bRotated = bRotated && CanRotate(Manifest);
+	Placement.Dimensions = GetItemDimensions(Manifest, Placement.bRotated);
+	Placement.bStackable = StackableFragment != nullptr;
+	Placement.MaxStackSize = StackableFragment ? StackableFragment->GetMaxStackSize() : 1;
+	Placement.StackCount = Placement.bStackable ? StackCount : 0;
+
+	return PlacePlacement(Index, MoveTemp(Placement));
+}
+
+bool FInv_GridModel::PlacePlacement(const int32 Index, FInv_GridPlacement&& Placement)
+{
+	if (!IsAreaEmpty(Index, Placement.Dimensions)) return false;
+
+	// 아이템이 차지하는 모든 셀에 좌상단 인덱스를 기록합니다
+	for (int32 Row = 0; Row < Placement.Dimensions.Y; ++Row)
+	{
+		for (int32 Column = 0; Column < Placement.Dimensions.X; ++Column)
+		{
+			UpperLeftIndices[Index + Row * Columns + Column] = Index;
+		}
+	}
+	Occupancy.SetRect(Index % Columns, Index / Columns, Placement.Dimensions.X, Placement.Dimensions.Y, true);
+	FreeRects.Occupy(FIntRect(Index % Columns, Index / Columns, Index % Columns + Placement.Dimensions.X, Index / Columns + Placement.Dimensions.Y));
+	SummedArea.Update(UpperLeftIndices, FIntPoint(Index % Columns, Index / Columns));
+	UpdatePartialStackIndex(Index, Placements.Add(Index, MoveTemp(Placement)));
+	++Revision;
+	return true;
+}
+
+bool FInv_GridModel::ApplyMoves(TArrayView<const FInv_GridMove> Moves)
+{
+	// 모든 출발 위치가 서로 다른 스택의 좌상단이어야 합니다
+	TSet<int32> FromIndices;
+	FromIndices.Reserve(Moves.Num());
+	for (const FInv_GridMove& Move : Moves)
+	{
+		if (GetUpperLeftIndex(Move.FromIndex) != Move.FromIndex) return false;
+
+		bool bAlreadyMoved = false;
+		FromIndices.Add(Move.FromIndex, &bAlreadyMoved);
+		if (bAlreadyMoved) return false;
+	}
+
+	// 이동할 스택을 모두 들어낸 뒤 새 위치에 배치합니다
+	TArray<FInv_GridPlacement> MovedPlacements;
+	MovedPlacements.Reserve(Moves.Num());
+	for (const FInv_GridMove& Move : Moves)
+	{
+		MovedPlacements.Add(Placements.FindChecked(Move.FromIndex));
+		RemoveItem(Move.FromIndex);
+	}
+
+	for (int32 i = 0; i < Moves.Num(); ++i)
+	{
+		if (PlacePlacement(Moves[i].ToIndex, CopyTemp(MovedPlacements[i]))) continue;
+
+		// 하나라도 배치할 수 없으면 모든 스택을 원래 위치로 되돌립니다
+		for (int32 j = 0; j < i; ++j)
+		{
+			RemoveItem(Moves[j].ToIndex);
+		}
+		for (int32 j = 0; j < Moves.Num(); ++j)
+		{
+			PlacePlacement(Moves[j].FromIndex, MoveTemp(MovedPlacements[j]));
+		}
+		return false;
+	}
+	return true;
+}
+
+int32 FInv_GridModel::RemoveItem(const int32 Index)
+{
+	const int32 UpperLeftIndex = GetUpperLeftIndex(Index);
+	if (UpperLeftIndex == INDEX_NONE) return INDEX_NONE;
+
+	FInv_GridPlacement Placement;
+	Placements.RemoveAndCopyValue(UpperLeftIndex, Placement);
+	UpdatePartialStackIndex(UpperLeftIndex, Placement, true);
+
+	// 아이템이 차지하던 모든 셀을 비웁니다
+	for (int32 Row = 0; Row < Placement.Dimensions.Y; ++Row)
+	{
+		for (int32 Column = 0; Column < Placement.Dimensions.X; ++Column)
+		{
+			UpperLeftIndices[UpperLeftIndex + Row * Columns + Column] = INDEX_NONE;
+		}
+	}
+	Occupancy.SetRect(UpperLeftIndex % Columns, UpperLeftIndex / Columns, Placement.Dimensions.X, Placement.Dimensions.Y, false);
+	FreeRects.Release(FIntRect(UpperLeftIndex % Columns, UpperLeftIndex / Columns, UpperLeftIndex % Columns + Placement.Dimensions.X, UpperLeftIndex / Columns + Placement.Dimensions.Y), Occupancy);
+	SummedArea.Update(UpperLeftIndices, FIntPoint(UpperLeftIndex % Columns, UpperLeftIndex / Columns));
+	++Revision;
+	return UpperLeftIndex;
+}
+
+TArray<FInv_GridStack> FInv_GridModel::GetItemStacks(const UInv_InventoryItem* Item) const
+{
+	TArray<FInv_GridStack> Stacks;
+	for (const auto& [UpperLeftIndex, Placement] : Placements)
+	{
+		if (Placement.Item != Item) continue;
+
+		FInv_GridStack& Stack = Stacks.AddDefaulted_GetRef();
+		Stack.Index = UpperLeftIndex;
+		Stack.StackCount = Placement.StackCount;
+		Stack.bRotated = Placement.bRotated;
+	}
+
+	// 배치 맵의 순회 순서는 정해져 있지 않으므로 비교할 수 있게 정렬합니다
+	Stacks.Sort([](const FInv_GridStack& A, const FInv_GridStack& B) { return A.Index < B.Index; });
+	return Stacks;
+}
+
+int32 FInv_GridModel::RemoveItemStacks(const UInv_InventoryItem* Item)
+{
+	const TArray<FInv_GridStack> Stacks = GetItemStacks(Item);
+	for (const FInv_GridStack& Stack : Stacks)
+	{
+		RemoveItem(Stack.Index);
+	}
+	return Stacks.Num();
+}
+
+void FInv_GridModel::SetStackCount(const int32 Index, const int32 StackCount)
+{
+	const int32 UpperLeftIndex = GetUpperLeftIndex(Index);
+	if (FInv_GridPlacement* Placement = Placements.Find(UpperLeftIndex))
+	{
+		Placement->StackCount = Placement->bStackable ? StackCount : 0;
+		UpdatePartialStackIndex(UpperLeftIndex, *Placement);
+	}
+}
+
+void FInv_GridModel::UpdatePartialStackIndex(const int32 UpperLeftIndex, const FInv_GridPlacement& Placement, const bool bRemoved)
+{
+	if (!Placement.bStackable) return;
+
+	// 좌상단 인덱스 순서를 유지하며 가득 차지 않은 스택만 인덱스에 남깁니다
+	const bool bPartial = !bRemoved && Placement.StackCount < Placement.MaxStackSize;
+	TArray<int32>& Indices = PartialStacksByType.FindOrAdd(Placement.ItemType);
+	const int32 Position = Algo::LowerBound(Indices, UpperLeftIndex);
+	const bool bIndexed = Indices.IsValidIndex(Position) && Indices[Position] == UpperLeftIndex;
+	if (bPartial && !bIndexed)
+	{
+		Indices.Insert(UpperLeftIndex, Position);
+	}
+	else if (!bPartial && bIndexed)
+	{
+		Indices.RemoveAt(Position);
+	}
+
+	if (Indices.IsEmpty())
+	{
+		PartialStacksByType.Remove(Placement.ItemType);
+	}
+}
+
+int32 FInv_GridModel::GetStackCount(const int32 Index) const
+{
+	const FInv_GridPlacement* Placement = FindPlacement(Index);
+	return Placement ? Placement->StackCount : 0;
+}
+
+UInv_InventoryItem* FInv_GridModel::GetItem(const int32 Index) const
+{
+	const FInv_GridPlacement* Placement = FindPlacement(Index);
+	return Placement ? Placement->Item.Get() : nullptr;
+}
+
+const FInv_GridPlacement* FInv_GridModel::FindPlacement(const int32 Index) const
+{
+	const int32 UpperLeftIndex = GetUpperLeftIndex(Index);
+	return UpperLeftIndex != INDEX_NONE ? Placements.Find(UpperLeftIndex) : nullptr;
+}
+
+FIntPoint FInv_GridModel::GetItemDimensions(const FInv_ItemManifest& Manifest, const bool bRotated)
+{
+	// 그리드 프래그먼트에서 아이템 크기를 가져옵니다 (없으면 기본 1x1)
+	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
+	return GridFragment ? GridFragment->GetGridSize(bRotated) : FIntPoint(1, 1);
+}
+
+bool FInv_GridModel::CanRotate(const FInv_ItemManifest& Manifest)
+{
+	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
+	return GridFragment && GridFragment->CanRotate();
+}
+
+int32 FInv_GridModel::GetAmountToAdd(const FInv_ItemManifest& Manifest)
+{
+	const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>();
+	return StackableFragment ? StackableFragment->GetStackCount() : 1;
+}
@@ -0,0 +1,128 @@
+#include "InventoryManagement/Grid/Inv_GridSummedArea.h"
+
+void FInv_GridSummedArea::Init(const int32 InRows, const int32 InColumns)
+{
+	Rows = FMath::Max(InRows, 0);
+	Columns = FMath::Max(InColumns, 0);
+
+	// 비어있는 그리드의 누적 합은 모두 0입니다
+	Sums.Reset();
+	Sums.SetNumZeroed((Rows + 1) * (Columns + 1));
+	Interior.Init(false, Rows * Columns);
+}
+
+void FInv_GridSummedArea::Update(const TArray<int32>& UpperLeftIndices, const FIntPoint& From)
+{
+	check(UpperLeftIndices.Num() == Rows * Columns);
+
+	const int32 Stride = Columns + 1;
+	for (int32 Row = FMath::Max(From.Y, 0); Row < Rows; ++Row)
+	{
+		for (int32 Column = FMath::Max(From.X, 0); Column < Columns; ++Column)
+		{
+			// 셀의 경계 표시를 계산합니다
+			const int32 Index = Column + Row * Columns;
+			const int32 UpperLeftIndex = UpperLeftIndices[Index];
+
+			FCellCounts Cell;
+			if (UpperLeftIndex != INDEX_NONE)
+			{
+				const bool bTopEdge = Row == 0 || UpperLeftIndices[Index - Columns] != UpperLeftIndex;
+				const bool bLeftEdge = Column == 0 || UpperLeftIndices[Index - 1] != UpperLeftIndex;
+				Cell.Occupied = 1;
+				Cell.UpperLeft = bTopEdge && bLeftEdge;
+				Cell.TopOnly = bTopEdge && !bLeftEdge;
+				Cell.LeftOnly = !bTopEdge && bLeftEdge;
+			}
+			Interior[Index] = UpperLeftIndex != INDEX_NONE && !Cell.UpperLeft && !Cell.TopOnly && !Cell.LeftOnly;
+
+			// 위쪽과 왼쪽 칸의 누적 합에 더합니다 (겹치는 좌상단 칸은 한 번 뺌)
+			const FCellCounts& Up = Sums[(Column + 1) + Row * Stride];
+			const FCellCounts& Left = Sums[Column + (Row + 1) * Stride];
+			const FCellCounts& UpLeft = Sums[Column + Row * Stride];
+			FCellCounts& Sum = Sums[(Column + 1) + (Row + 1) * Stride];
+			Sum.Occupied = Cell.Occupied + Up.Occupied + Left.Occupied - UpLeft.Occupied;
+			Sum.UpperLeft = Cell.UpperLeft + Up.UpperLeft + Left.UpperLeft - UpLeft.UpperLeft;
+			Sum.TopOnly = Cell.TopOnly + Up.TopOnly + Left.TopOnly - UpLeft.TopOnly;
+			Sum.LeftOnly = Cell.LeftOnly + Up.LeftOnly + Left.LeftOnly - UpLeft.LeftOnly;
+		}
+	}
+}
+
+FInv_GridSummedArea::FCellCounts FInv_GridSummedArea::SumRect(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const
+{
+	const FCellCounts& BottomRight = At(Column + Width, Row + Height);
+	const FCellCounts& TopRight = At(Column + Width, Row);
+	const FCellCounts& BottomLeft = At(Column, Row + Height);
+	const FCellCounts& TopLeft = At(Column, Row);
+
+	FCellCounts Result;
+	Result.Occupied = BottomRight.Occupied - TopRight.Occupied - BottomLeft.Occupied + TopLeft.Occupied;
+	Result.UpperLeft = BottomRight.UpperLeft - TopRight.UpperLeft - BottomLeft.UpperLeft + TopLeft.UpperLeft;
+	Result.TopOnly = BottomRight.TopOnly - TopRight.TopOnly - BottomLeft.TopOnly + TopLeft.TopOnly;
+	Result.LeftOnly = BottomRight.LeftOnly - TopRight.LeftOnly - BottomLeft.LeftOnly + TopLeft.LeftOnly;
+	return Result;
+}
+
+bool FInv_GridSummedArea::IsRectEmpty(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const
+{
+	if (Width <= 0 || Height <= 0) return true;
+	return SumRect(Column, Row, Width, Height).Occupied == 0;
+}
+
+int32 FInv_GridSummedArea::CountItems(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const
+{
+	if (Width <= 0 || Height <= 0) return 0;
+
+	// 좌상단이 영역 안에 있는 아이템
+	int32 Count = SumRect(Column, Row, Width, Height).UpperLeft;
+
+	// 왼쪽 경계를 넘어 들어온 아이템: 영역의 왼쪽 열에서 아이템의 위쪽 경계가 시작됩니다
+	Count += SumRect(Column, Row, 1, Height).TopOnly;
+
+	// 위쪽 경계를 넘어 들어온 아이템: 영역의 위쪽 행에서 아이템의 왼쪽 경계가 시작됩니다
+	Count += SumRect(Column, Row, Width, 1).LeftOnly;
+
+	// 왼쪽과 위쪽 경계를 모두 넘는 아이템: 영역의 좌상단 셀이 아이템의 내부입니다
+	Count += Interior[Column + Row * Columns] ? 1 : 0;
+	return Count;
+}
+
+int32 FInv_GridSummedArea::FindFirstOccupied(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const
+{
+	if (IsRectEmpty(Column, Row, Width, Height)) return INDEX_NONE;
+
+	// 영역의 윗부분 [Row, FoundRow]에 점유된 셀이 생기는 첫 번째 행
+	int32 Low = Row;
+	int32 High = Row + Height - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (IsRectEmpty(Column, Row, Width, Mid - Row + 1))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	const int32 FoundRow = Low;
+
+	// 그 행의 [Column, FoundColumn]에 점유된 셀이 생기는 첫 번째 열
+	Low = Column;
+	High = Column + Width - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (IsRectEmpty(Column, FoundRow, Mid - Column + 1, 1))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low + FoundRow * Columns;
+}
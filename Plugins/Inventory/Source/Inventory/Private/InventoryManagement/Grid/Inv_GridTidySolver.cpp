@@ -0,0 +1,65 @@
+#include "InventoryManagement/Grid/Inv_GridTidySolver.h"
+
+#include "HAL/PlatformTime.h"
+#include "InventoryManagement/Grid/Inv_FreeRectIndex.h"
+#include "InventoryManagement/Grid/Inv_GridModel.h"
+
+FInv_GridTidySolver::FInv_GridTidySolver(const FInv_GridModel& GridModel)
+	: Category(GridModel.GetItemCategory())
+	, Revision(GridModel.GetRevision())
+	, Rows(GridModel.GetRows())
+	, Columns(GridModel.GetColumns())
+{
+	Items.Reserve(GridModel.GetPlacements().Num());
+	for (const auto& [Index, Placement] : GridModel.GetPlacements())
+	{
+		Items.Add(FTidyItem{Index, Placement.Dimensions, Placement.ItemType});
+	}
+}
+
+FInv_TidyResult FInv_GridTidySolver::Solve(const double TimeBudgetSeconds) const
+{
+	FInv_TidyResult Result;
+	Result.Category = Category;
+	Result.Revision = Revision;
+
+	const double Deadline = FPlatformTime::Seconds() + TimeBudgetSeconds;
+
+	// 큰 스택부터, 같은 크기라면 같은 타입끼리 모이도록 정렬합니다
+	// 완전히 같은 조건이면 현재 위치 순서를 유지해 불필요한 이동을 줄입니다
+	TArray<FTidyItem> SortedItems = Items;
+	SortedItems.Sort([](const FTidyItem& A, const FTidyItem& B)
+	{
+		const int32 AreaA = A.Dimensions.X * A.Dimensions.Y;
+		const int32 AreaB = B.Dimensions.X * B.Dimensions.Y;
+		if (AreaA != AreaB) return AreaA > AreaB;
+		if (A.Dimensions.Y != B.Dimensions.Y) return A.Dimensions.Y > B.Dimensions.Y;
+		if (A.ItemType != B.ItemType) return A.ItemType.GetTagName().LexicalLess(B.ItemType.GetTagName());
+		return A.UpperLeftIndex < B.UpperLeftIndex;
+	});
+
+	// 빈 그리드에 정렬된 순서대로 첫 번째로 맞는 위치에 배치합니다
+	FInv_FreeRectIndex FreeRects;
+	FreeRects.Init(Rows, Columns);
+
+	for (const FTidyItem& Item : SortedItems)
+	{
+		// 시간 예산을 넘기면 결과를 버리고 현재 배치를 유지합니다
+		if (FPlatformTime::Seconds() > Deadline) return Result;
+
+		// 정렬 순서 때문에 원래 들어가던 스택이 들어가지 않을 수 있으며, 이 경우에도 현재 배치를 유지합니다
+		const int32 Index = FreeRects.FindFirstFit(Item.Dimensions);
+		if (Index == INDEX_NONE) return Result;
+
+		const FIntPoint Position(Index % Columns, Index / Columns);
+		FreeRects.Occupy(FIntRect(Position, Position + Item.Dimensions));
+
+		if (Index != Item.UpperLeftIndex)
+		{
+			Result.Moves.Emplace(Item.UpperLeftIndex, Index);
+		}
+	}
+
+	Result.bSolved = true;
+	return Result;
+}
@@ -3,6 +3,8 @@
 
 #include "Items/Components/Inv_ItemComponent.h"
 
+#include "Items/Fragments/Inv_ItemFragment.h"
+#include "Items/Manifest/Inv_ItemDefinitionRegistry.h"
 #include "Net/UnrealNetwork.h"
 
 
@@ -18,7 +20,23 @@ void UInv_ItemComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, ItemManifest);
+	DOREPLIFETIME(ThisClass, InstanceData);
+}
+
+void UInv_ItemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 드롭으로 스폰된 픽업도 InitItemManifest 전에 BeginPlay가 호출되므로 여기서는 항상 작성된 매니페스트를 등록합니다
+	if (UInv_ItemDefinitionRegistry* Registry = UInv_ItemDefinitionRegistry::Get(this))
+	{
+		Registry->RegisterDefinition(ItemManifest);
+	}
+
+	if (GetOwner()->HasAuthority() && !InstanceData.IsValid())
+	{
+		InstanceData = ItemManifest.MakeInstanceData();
+	}
 }
 
 void UInv_ItemComponent::InitItemManifest(FInv_ItemManifest CopyOfManifest)
@@ -26,6 +44,26 @@ void UInv_ItemComponent::InitItemManifest(FInv_ItemManifest CopyOfManifest)
 	// 전달받은 매니페스트로 아이템 정보를 설정합니다
 	// 드롭된 아이템이 월드에 스폰될 때 올바른 아이템 정보를 가지도록 합니다
 	ItemManifest = CopyOfManifest;
+	InstanceData = ItemManifest.MakeInstanceData();
+}
+
+void UInv_ItemComponent::SetRemainingStackCount(int32 StackCount)
+{
+	FInv_StackableFragment* StackableFragment = ItemManifest.GetFragmentOfTypeMutable<FInv_StackableFragment>();
+	if (!StackableFragment) return;
+
+	StackableFragment->SetStackCount(StackCount);
+	InstanceData.StackCount = StackCount;
+}
+
+void UInv_ItemComponent::OnRep_InstanceData()
+{
+	// 정의를 찾지 못하면 액터에 작성된 매니페스트를 복제된 시드로 다시 롤합니다
+	UInv_ItemDefinitionRegistry* Registry = UInv_ItemDefinitionRegistry::Get(this);
+	if (!IsValid(Registry) || !Registry->BuildManifest(InstanceData, ItemManifest))
+	{
+		ItemManifest.ApplyInstanceData(InstanceData);
+	}
 }
 
 void UInv_ItemComponent::PickedUp()
@@ -6,98 +6,198 @@
 #include "Items/Fragments/Inv_ItemFragment.h"
 
 #include "EquipmentManagement/EquipActor/Inv_EquipActor.h"
-#include "Widgets/Composite/Inv_CompositeBase.h"
-#include "Widgets/Composite/Inv_Leaf_Image.h"
-#include "Widgets/Composite/Inv_Leaf_LabeledValue.h"
-#include "Widgets/Composite/Inv_Leaf_Text.h"
-#include "EquipmentManagement/EquipActor/Inv_EquipActor.h"
+#include "UObject/CoreNet.h"
+#include "Widgets/ItemDescription/Inv_ItemDescriptionPayload.h"
 
-/**
- * 이 프래그먼트의 데이터를 컴포지트 위젯에 동화시킵니다
- * 먼저 GameplayTag가 일치하는지 확인하고, 일치하면 위젯을 확장(Expand)합니다
- * 이를 통해 위젯이 이 프래그먼트의 데이터를 표시할 준비를 합니다
- */
-void FInv_InventoryItemFragment::Assimilate(UInv_CompositeBase* Composite) const
+namespace
 {
-    if (!MatchesWidgetTag(Composite)) return;
-    Composite->Expand();
+	/** 불리언을 1비트로 직렬화합니다 */
+	void NetSerializeBool(FArchive& Ar, bool& bValue)
+	{
+		uint8 Bit = bValue ? 1 : 0;
+		Ar.SerializeBits(&Bit, 1);
+		bValue = Bit != 0;
+	}
+
+	/** 음수가 될 수 있는 정수를 지그재그 인코딩 후 가변 길이로 직렬화합니다 */
+	void NetSerializeSignedPacked(FArchive& Ar, int64& Value)
+	{
+		uint64 ZigZag = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+		Ar.SerializeIntPacked64(ZigZag);
+		Value = static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1);
+	}
+
+	/** 실수를 표시하는 소수점 자릿수까지만 남겨 정수로 직렬화합니다 */
+	void NetSerializeQuantized(FArchive& Ar, float& Value, const int32 FractionalDigits)
+	{
+		const double Scale = FMath::Pow(10.0, FMath::Clamp(FractionalDigits, 0, 9));
+		int64 Quantized = Ar.IsSaving() ? FMath::RoundToInt64(Value * Scale) : 0;
+		NetSerializeSignedPacked(Ar, Quantized);
+		if (Ar.IsLoading())
+		{
+			Value = static_cast<float>(Quantized / Scale);
+		}
+	}
+
+	/** 음수가 아닌 정수를 가변 길이로 직렬화합니다 */
+	void NetSerializePacked(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = static_cast<uint32>(FMath::Max(Value, 0));
+		Ar.SerializeIntPacked(Packed);
+		Value = static_cast<int32>(Packed);
+	}
+
+	/** 클래스 참조를 아카이브의 오브젝트 직렬화로 보냅니다 (네트 아카이브는 패키지 맵의 네트 GUID로 보냄) */
+	template<typename T>
+	void NetSerializeClass(FArchive& Ar, TSubclassOf<T>& Class)
+	{
+		UObject* Object = Class.Get();
+		Ar << Object;
+		if (Ar.IsLoading())
+		{
+			Class = Cast<UClass>(Object);
+		}
+	}
 }
 
 /**
- * 이 프래그먼트의 GameplayTag와 위젯의 FragmentTag를 정확히 비교합니다
- * 태그가 정확히 일치해야만 true를 반환하며, 부모 태그 매칭은 허용하지 않습니다
+ * 네트워크 직렬화에서 인덱스로 보내는 플러그인 기본 프래그먼트 타입 목록
+ * 인덱스가 프로토콜이므로 새 타입은 끝에만 추가합니다 (0은 기본 타입이 아님을 뜻함)
  */
-bool FInv_InventoryItemFragment::MatchesWidgetTag(const UInv_CompositeBase* Composite) const
+static TConstArrayView<const UScriptStruct*> GetBuiltInFragmentTypes()
 {
-    return Composite->GetFragmentTag().MatchesTagExact(GetFragmentTag());
+	static const UScriptStruct* const BuiltInFragmentTypes[] =
+	{
+		FInv_GridFragment::StaticStruct(),
+		FInv_ImageFragment::StaticStruct(),
+		FInv_TextFragment::StaticStruct(),
+		FInv_LabeledNumberFragment::StaticStruct(),
+		FInv_StackableFragment::StaticStruct(),
+		FInv_ConsumableFragment::StaticStruct(),
+		FInv_HealthPotionFragment::StaticStruct(),
+		FInv_ManaPotionFragment::StaticStruct(),
+		FInv_EquipmentFragment::StaticStruct(),
+		FInv_StrengthModifier::StaticStruct(),
+	};
+	static_assert(UE_ARRAY_COUNT(BuiltInFragmentTypes) < MaxBuiltInFragmentTypes);
+	return BuiltInFragmentTypes;
 }
 
-/**
- * 이미지 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
- *
- * 위젯 태그가 프래그먼트 태그와 일치하는지 확인한 후,
- * UInv_Leaf_Image 위젯에 아이콘 텍스처와 크기 정보를 설정합니다.
- */
-void FInv_ImageFragment::Assimilate(UInv_CompositeBase* Composite) const
+uint32 GetBuiltInFragmentTypeIndex(const UScriptStruct* FragmentType)
 {
-	// 부모 클래스의 Assimilate를 먼저 호출합니다
-	FInv_InventoryItemFragment::Assimilate(Composite);
-
-	// 위젯 태그가 프래그먼트 태그와 일치하는지 확인합니다
-	if (!MatchesWidgetTag(Composite)) return;
+	if (!FragmentType) return 0;
 
-	// 컴포지트를 UInv_Leaf_Image로 캐스팅합니다
-	UInv_Leaf_Image* Image = Cast<UInv_Leaf_Image>(Composite);
-	if (!IsValid(Image)) return;
+	const int32 Index = GetBuiltInFragmentTypes().Find(FragmentType);
+	return Index == INDEX_NONE ? 0 : static_cast<uint32>(Index + 1);
+}
 
-	// 이미지 위젯에 아이콘과 크기를 설정합니다
-	Image->SetImage(Icon);
-	Image->SetBoxSize(IconDimensions);
-	Image->SetImageSize(IconDimensions);
+const UScriptStruct* GetBuiltInFragmentType(const uint32 TypeIndex)
+{
+	const TConstArrayView<const UScriptStruct*> BuiltInFragmentTypes = GetBuiltInFragmentTypes();
+	if (TypeIndex == 0 || TypeIndex > static_cast<uint32>(BuiltInFragmentTypes.Num())) return nullptr;
+	return BuiltInFragmentTypes[TypeIndex - 1];
 }
 
 /**
- * 텍스트 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
- *
- * 위젯 태그가 프래그먼트 태그와 일치하는지 확인한 후,
- * UInv_Leaf_Text 위젯에 텍스트 정보를 설정합니다.
+ * 프래그먼트 태그를 직렬화합니다
+ * 게임플레이 태그 설정에서 Fast Replication을 켜면 태그 이름 대신 네트 인덱스로 보내집니다
  */
-void FInv_TextFragment::Assimilate(UInv_CompositeBase* Composite) const
+void FInv_ItemFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
-	// 부모 클래스의 Assimilate를 먼저 호출합니다
-	FInv_InventoryItemFragment::Assimilate(Composite);
+	FrgmentTag.NetSerialize(Ar, Map, bOutSuccess);
+}
 
-	// 위젯 태그가 프래그먼트 태그와 일치하는지 확인합니다
-	if (!MatchesWidgetTag(Composite)) return;
+void FInv_GridFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_ItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
 
-	// 컴포지트를 UInv_Leaf_Text로 캐스팅합니다
-	UInv_Leaf_Text* LeafText = Cast<UInv_Leaf_Text>(Composite);
-	if (!IsValid(LeafText)) return;
+	NetSerializePacked(Ar, GridSize.X);
+	NetSerializePacked(Ar, GridSize.Y);
+	NetSerializeBool(Ar, bRotatable);
+	NetSerializeQuantized(Ar, GridPadding, 1);
+}
+
+void FInv_ImageFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_InventoryItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
 
-	// 텍스트 위젯에 텍스트를 설정합니다
-	LeafText->SetText(FragmentText);
+	// 아이콘은 소프트 레퍼런스이므로 경로만 보냅니다
+	FSoftObjectPath IconPath = Icon.ToSoftObjectPath();
+	IconPath.NetSerialize(Ar, Map, bOutSuccess);
+	if (Ar.IsLoading())
+	{
+		Icon = TSoftObjectPtr<UTexture2D>(IconPath);
+	}
+
+	float IconWidth = IconDimensions.X;
+	float IconHeight = IconDimensions.Y;
+	NetSerializeQuantized(Ar, IconWidth, 1);
+	NetSerializeQuantized(Ar, IconHeight, 1);
+	IconDimensions = FVector2D(IconWidth, IconHeight);
+}
+
+void FInv_TextFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_InventoryItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
+
+	Ar << FragmentText;
+}
+
+/**
+ * 이 프래그먼트의 데이터를 설명 페이로드에 동화시킵니다
+ * 태그가 일치하는 위젯을 확장(Expand)하는 항목을 추가합니다
+ * 이를 통해 위젯이 이 프래그먼트의 데이터를 표시할 준비를 합니다
+ */
+void FInv_InventoryItemFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
+{
+    FInv_DescriptionEntry& Entry = Payload.Entries.AddDefaulted_GetRef();
+    Entry.Tag = GetFragmentTag();
 }
 
 /**
- * 라벨과 숫자 데이터를 컴포지트 위젯에 동화시킵니다
+ * 이미지 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
  *
- * 위젯 태그가 프래그먼트 태그와 일치하는지 확인한 후,
- * UInv_Leaf_LabeledValue 위젯에 라벨과 포맷팅된 숫자 값을 설정합니다.
+ * UInv_Leaf_Image 위젯에 설정할 아이콘 텍스처와 크기 정보를 추가합니다.
  */
-void FInv_LabeledNumberFragment::Assimilate(UInv_CompositeBase* Composite) const
+void FInv_ImageFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
 {
-	// 부모 클래스의 Assimilate를 먼저 호출합니다
-	FInv_InventoryItemFragment::Assimilate(Composite);
+	// 이미지 위젯에 설정할 아이콘과 크기를 추가합니다
+	FInv_DescriptionEntry& Entry = Payload.Entries.AddDefaulted_GetRef();
+	Entry.Type = EInv_DescriptionEntryType::Image;
+	Entry.Tag = GetFragmentTag();
+	Entry.Icon = Icon;
+	Entry.IconDimensions = IconDimensions;
+}
 
-	// 위젯 태그가 프래그먼트 태그와 일치하는지 확인합니다
-	if (!MatchesWidgetTag(Composite)) return;
+/**
+ * 텍스트 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
+ *
+ * UInv_Leaf_Text 위젯에 설정할 텍스트 정보를 추가합니다.
+ */
+void FInv_TextFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
+{
+	// 텍스트 위젯에 설정할 텍스트를 추가합니다
+	FInv_DescriptionEntry& Entry = Payload.Entries.AddDefaulted_GetRef();
+	Entry.Type = EInv_DescriptionEntryType::Text;
+	Entry.Tag = GetFragmentTag();
+	Entry.Text = FragmentText;
+}
 
-	// 컴포지트를 UInv_Leaf_LabeledValue로 캐스팅합니다
-	UInv_Leaf_LabeledValue* LabeledValue = Cast<UInv_Leaf_LabeledValue>(Composite);
-	if (!IsValid(LabeledValue)) return;
+/**
+ * 라벨과 숫자 데이터를 설명 페이로드에 동화시킵니다
+ *
+ * UInv_Leaf_LabeledValue 위젯에 설정할 라벨과 포맷팅된 숫자 값을 추가합니다.
+ * 숫자 포맷은 페이로드를 만들 때 한 번만 수행됩니다.
+ */
+void FInv_LabeledNumberFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
+{
+	FInv_DescriptionEntry& Entry = Payload.Entries.AddDefaulted_GetRef();
+	Entry.Type = EInv_DescriptionEntryType::LabeledValue;
+	Entry.Tag = GetFragmentTag();
 
 	// 라벨 텍스트를 설정합니다 (예: "공격력:")
-	LabeledValue->SetText_Label(Text_Label, bCollapseLabel);
+	Entry.Text = Text_Label;
+	Entry.bCollapseLabel = bCollapseLabel;
 
 	// 숫자 포맷 옵션을 설정합니다 (소수점 자릿수 제어)
 	FNumberFormattingOptions Options;
@@ -105,7 +205,8 @@ void FInv_LabeledNumberFragment::Assimilate(UInv_CompositeBase* Composite) const
 	Options.MaximumFractionalDigits = MaxFractionalDigits;  // 최대 소수점 자릿수
 
 	// 값을 포맷팅하여 텍스트로 설정합니다 (예: "25.5")
-	LabeledValue->SetText_Value(FText::AsNumber(Value, &Options), bCollapseValue);
+	Entry.Value = FText::AsNumber(Value, &Options);
+	Entry.bCollapseValue = bCollapseValue;
 }
 
 /**
@@ -114,16 +215,19 @@ void FInv_LabeledNumberFragment::Assimilate(UInv_CompositeBase* Composite) const
  * 처음 아이템이 생성될 때만 Min~Max 범위에서 랜덤 값을 생성하고,
  * 이후에는 동일한 값을 유지합니다 (장착/해제 시에도 값 유지).
  */
-void FInv_LabeledNumberFragment::Manifest()
+void FInv_LabeledNumberFragment::Manifest(FRandomStream& RandomStream)
 {
 	// 부모 클래스의 Manifest를 먼저 호출합니다
-	FInv_InventoryItemFragment::Manifest();
+	FInv_InventoryItemFragment::Manifest(RandomStream);
 
-	// 처음 생성 시에만 랜덤 값을 생성합니다
+	// Min과 Max 사이의 랜덤 float 값을 뽑습니다
+	// 값을 쓰지 않더라도 항상 뽑아야 뒤따르는 프래그먼트가 스트림의 같은 위치에서 값을 뽑습니다
+	const float RolledValue = RandomStream.FRandRange(Min, Max);
+
+	// 처음 생성 시에만 랜덤 값을 적용합니다
 	if (bRandomizeOnManifest)
 	{
-		// Min과 Max 사이의 랜덤 float 값을 생성합니다
-		Value = FMath::FRandRange(Min, Max);
+		Value = RolledValue;
 	}
 
 	// 한 번 랜덤화한 후에는 더 이상 랜덤화하지 않도록 플래그를 false로 설정합니다
@@ -131,6 +235,54 @@ void FInv_LabeledNumberFragment::Manifest()
 	bRandomizeOnManifest = false;
 }
 
+/**
+ * 라벨 숫자 프래그먼트를 네트워크용으로 직렬화합니다
+ *
+ * 표시되는 값은 화면에 표시되는 MaxFractionalDigits 자릿수까지만 양자화해 가변 길이 정수로 보냅니다.
+ * 받는 쪽이 같은 배율로 복원할 수 있도록 자릿수를 먼저 직렬화합니다.
+ * Min/Max는 롤 범위이므로 전체 정밀도로 보냅니다 (받은 정의로 같은 시드를 롤하면 서버와 같은 값이 나와야 함).
+ */
+void FInv_LabeledNumberFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_InventoryItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
+
+	Ar << Text_Label;
+	NetSerializePacked(Ar, MinFractionalDigits);
+	NetSerializePacked(Ar, MaxFractionalDigits);
+	NetSerializeBool(Ar, bCollapseLabel);
+	NetSerializeBool(Ar, bCollapseValue);
+	NetSerializeBool(Ar, bRandomizeOnManifest);
+
+	NetSerializeQuantized(Ar, Value, MaxFractionalDigits);
+	Ar << Min;
+	Ar << Max;
+}
+
+/**
+ * 스택 가능 프래그먼트를 네트워크용으로 직렬화합니다
+ *
+ * 스택 수량이 최대 스택 크기 이하이면 MaxStackSize를 표현하는 데 필요한 비트만 사용합니다.
+ * 월드의 픽업처럼 최대 크기를 넘는 수량은 1비트 표시 후 가변 길이로 보냅니다.
+ */
+void FInv_StackableFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_ItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
+
+	NetSerializePacked(Ar, MaxStackSize);
+
+	bool bExceedsMaxStackSize = StackCount < 0 || StackCount > MaxStackSize;
+	NetSerializeBool(Ar, bExceedsMaxStackSize);
+	if (bExceedsMaxStackSize)
+	{
+		NetSerializePacked(Ar, StackCount);
+		return;
+	}
+
+	uint32 PackedStackCount = static_cast<uint32>(StackCount);
+	Ar.SerializeInt(PackedStackCount, static_cast<uint32>(FMath::Max(MaxStackSize, 0)) + 1);
+	StackCount = static_cast<int32>(PackedStackCount);
+}
+
 /**
  * 소비형 아이템을 사용하여 모든 수정자의 효과를 적용합니다
  *
@@ -152,25 +304,25 @@ void FInv_ConsumableFragment::OnConsume(APlayerController* PC)
 }
 
 /**
- * 소비형 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
+ * 소비형 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
  *
  * 부모 클래스의 Assimilate를 호출한 후, 모든 ConsumeModifier의 데이터를
- * 순회하며 각각 위젯에 동화시킵니다. 이를 통해 UI에 모든 소비 효과 정보가
+ * 순회하며 각각 동화시킵니다. 이를 통해 UI에 모든 소비 효과 정보가
  * 표시됩니다 (예: "체력 +20", "마나 +10").
  *
- * @param Composite 데이터를 동화시킬 컴포지트 위젯
+ * @param Payload 설명 항목을 추가할 페이로드
  */
-void FInv_ConsumableFragment::Assimilate(UInv_CompositeBase* Composite) const
+void FInv_ConsumableFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
 {
 	// 부모 클래스의 Assimilate를 먼저 호출합니다
-	FInv_InventoryItemFragment::Assimilate(Composite);
+	FInv_InventoryItemFragment::Assimilate(Payload);
 
-	// 모든 소비 수정자를 순회하며 각각을 위젯에 동화시킵니다
+	// 모든 소비 수정자를 순회하며 각각을 동화시킵니다
 	for (const auto& Modifier : ConsumeModifiers)
 	{
 		// TInstancedStruct에서 상수 참조를 얻어 Assimilate를 호출합니다
 		const auto& ModRef = Modifier.Get();
-		ModRef.Assimilate(Composite);
+		ModRef.Assimilate(Payload);
 	}
 }
 
@@ -181,20 +333,27 @@ void FInv_ConsumableFragment::Assimilate(UInv_CompositeBase* Composite) const
  * Manifest()를 호출하여 랜덤 값 생성 등의 초기화 작업을 수행합니다.
  * 이를 통해 각 소비 효과의 수치가 Min~Max 범위에서 자동 설정됩니다.
  */
-void FInv_ConsumableFragment::Manifest()
+void FInv_ConsumableFragment::Manifest(FRandomStream& RandomStream)
 {
 	// 부모 클래스의 Manifest를 먼저 호출합니다
-	FInv_InventoryItemFragment::Manifest();
+	FInv_InventoryItemFragment::Manifest(RandomStream);
 
 	// 모든 소비 수정자를 순회하며 각각을 초기화합니다
 	for (auto& Modifier : ConsumeModifiers)
 	{
 		// TInstancedStruct에서 가변 참조를 얻어 Manifest를 호출합니다
 		auto& ModRef = Modifier.GetMutable();
-		ModRef.Manifest();
+		ModRef.Manifest(RandomStream);
 	}
 }
 
+void FInv_ConsumableFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_InventoryItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
+
+	NetSerializeFragmentArray(ConsumeModifiers, Ar, Map, bOutSuccess);
+}
+
 void FInv_HealthPotionFragment::OnConsume(APlayerController* PC)
 {
     // 실제 구현에서는 다음 중 하나를 사용하여 체력을 회복시킵니다:
@@ -286,21 +445,21 @@ void FInv_EquipmentFragment::OnUnequip(APlayerController* PC)
 }
 
 /**
- * 장비 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
+ * 장비 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
  * 부모 클래스의 Assimilate를 호출한 후, 모든 EquipModifier의 데이터를
- * 순회하며 각각 위젯에 동화시킵니다
+ * 순회하며 각각 동화시킵니다
  *
- * @param Composite 데이터를 동화시킬 컴포지트 위젯
+ * @param Payload 설명 항목을 추가할 페이로드
  */
-void FInv_EquipmentFragment::Assimilate(UInv_CompositeBase* Composite) const
+void FInv_EquipmentFragment::Assimilate(FInv_ItemDescriptionPayload& Payload) const
 {
-	FInv_InventoryItemFragment::Assimilate(Composite);
+	FInv_InventoryItemFragment::Assimilate(Payload);
 
-	// 모든 장비 수정자를 순회하며 각각을 위젯에 동화시킵니다
+	// 모든 장비 수정자를 순회하며 각각을 동화시킵니다
 	for (const auto& Modifier : EquipModifiers)
 	{
 		const auto& ModRef = Modifier.Get();
-		ModRef.Assimilate(Composite);
+		ModRef.Assimilate(Payload);
 	}
 }
 
@@ -309,18 +468,35 @@ void FInv_EquipmentFragment::Assimilate(UInv_CompositeBase* Composite) const
  * 부모 클래스의 Manifest를 호출한 후, 모든 EquipModifier에 대해
  * Manifest()를 호출하여 랜덤 스탯 값 생성 등의 초기화 작업을 수행합니다
  */
-void FInv_EquipmentFragment::Manifest()
+void FInv_EquipmentFragment::Manifest(FRandomStream& RandomStream)
 {
-	FInv_InventoryItemFragment::Manifest();
+	FInv_InventoryItemFragment::Manifest(RandomStream);
 
 	// 모든 장비 수정자를 순회하며 각각을 초기화합니다
 	for (auto& Modifier : EquipModifiers)
 	{
 		auto& ModRef = Modifier.GetMutable();
-		ModRef.Manifest();
+		ModRef.Manifest(RandomStream);
 	}
 }
 
+/**
+ * 장비 프래그먼트를 네트워크용으로 직렬화합니다
+ * 장착된 액터는 각 머신에서 따로 스폰하므로 보내지 않습니다
+ */
+void FInv_EquipmentFragment::NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	FInv_InventoryItemFragment::NetSerializeFragment(Ar, Map, bOutSuccess);
+
+	NetSerializeFragmentArray(EquipModifiers, Ar, Map, bOutSuccess);
+	if (Ar.IsError()) return;
+
+	NetSerializeClass(Ar, EquipActorClass);
+	UPackageMap::StaticSerializeName(Ar, SocketAttachPoint);
+	EquipmentType.NetSerialize(Ar, Map, bOutSuccess);
+	NetSerializeBool(Ar, bEquipped);
+}
+
 /**
  * 장비 액터를 스폰하고 스켈레탈 메시에 부착합니다
  * EquipActorClass를 사용하여 월드에 액터를 생성하고,
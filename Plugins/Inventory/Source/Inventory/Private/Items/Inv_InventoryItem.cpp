@@ -3,20 +3,71 @@
 
 #include "Items/Inv_InventoryItem.h"
 
+#include "GameFramework/Actor.h"
+#include "Internationalization/Culture.h"
+#include "InventoryManagement/Components/Inv_InventoryComponent.h"
 #include "Items/Fragments/Inv_ItemFragment.h"
+#include "Items/Manifest/Inv_ItemDefinitionRegistry.h"
 #include "Net/UnrealNetwork.h"
 
 void UInv_InventoryItem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	UObject::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass,ItemManifest);
-	DOREPLIFETIME(ThisClass,TotalStackCount);
+	DOREPLIFETIME_CONDITION(ThisClass, InstanceData, COND_InitialOnly);
 }
 
 void UInv_InventoryItem::SetItemManifest(const FInv_ItemManifest& Manifest)
 {
 	ItemManifest = FInstancedStruct::Make<FInv_ItemManifest>(Manifest);
+	InstanceData = Manifest.MakeInstanceData();
+	++ManifestRevision;
+}
+
+bool UInv_InventoryItem::RebuildItemManifest()
+{
+	const AActor* OwningActor = GetTypedOuter<AActor>();
+	UInv_InventoryComponent* InventoryComponent = IsValid(OwningActor) ? OwningActor->FindComponentByClass<UInv_InventoryComponent>() : nullptr;
+
+	FInv_ItemManifest Manifest;
+	UInv_ItemDefinitionRegistry* Registry = UInv_ItemDefinitionRegistry::Get(this);
+	if (!IsValid(Registry) || !Registry->BuildManifest(InstanceData, Manifest))
+	{
+		// 이 클라이언트가 픽업이나 정의 에셋으로 본 적 없는 타입이면 서버에 정의를 요청합니다
+		// 그때까지 매니페스트 없이 두어 인벤토리가 이 아이템을 그리드에 배치하지 않게 합니다
+		if (IsValid(InventoryComponent))
+		{
+			InventoryComponent->RequestItemDefinition(this);
+		}
+		return false;
+	}
+
+	ItemManifest = FInstancedStruct::Make<FInv_ItemManifest>(MoveTemp(Manifest));
+	++ManifestRevision;
+
+	// 인벤토리 엔트리가 이 아이템보다 먼저 복제되었다면 지금 추가된 것으로 처리합니다
+	if (IsValid(InventoryComponent))
+	{
+		InventoryComponent->HandleItemManifestReady(this);
+	}
+	return true;
+}
+
+void UInv_InventoryItem::OnRep_InstanceData()
+{
+	RebuildItemManifest();
+}
+
+const FInv_ItemDescriptionPayload& UInv_InventoryItem::GetDescriptionPayload() const
+{
+	// 숫자 포맷은 로캘에 따라 다르므로 로캘도 캐시 키에 포함합니다
+	const FString& Locale = FInternationalization::Get().GetCurrentLocale()->GetName();
+	if (!DescriptionPayload.IsValidFor(ManifestRevision, Locale))
+	{
+		DescriptionPayload.Reset(ManifestRevision, Locale);
+		GetItemManifest().BuildDescriptionPayload(DescriptionPayload);
+	}
+	return DescriptionPayload;
 }
 
 bool UInv_InventoryItem::IsStackable() const
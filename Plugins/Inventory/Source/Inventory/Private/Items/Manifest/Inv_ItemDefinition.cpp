@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Items/Manifest/Inv_ItemDefinition.h"
+
+const FPrimaryAssetType UInv_ItemDefinition::PrimaryAssetType(TEXT("Inv_ItemDefinition"));
+
+FPrimaryAssetId UInv_ItemDefinition::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, ItemManifest.GetItemType().GetTagName());
+}
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Items/Manifest/Inv_ItemDefinitionRegistry.h"
+
+#include "Inventory.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Items/Manifest/Inv_ItemDefinition.h"
+
+UInv_ItemDefinitionRegistry* UInv_ItemDefinitionRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!IsValid(World)) return nullptr;
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	if (!IsValid(GameInstance)) return nullptr;
+	return GameInstance->GetSubsystem<UInv_ItemDefinitionRegistry>();
+}
+
+void UInv_ItemDefinitionRegistry::RegisterDefinition(const FInv_ItemManifest& Manifest)
+{
+	if (!Manifest.GetItemType().IsValid() || Definitions.Contains(Manifest.GetItemType())) return;
+	Definitions.Add(Manifest.GetItemType(), Manifest);
+}
+
+const FInv_ItemManifest* UInv_ItemDefinitionRegistry::FindDefinition(const FGameplayTag& ItemType)
+{
+	if (!ItemType.IsValid()) return nullptr;
+
+	if (const FInv_ItemManifest* Definition = Definitions.Find(ItemType))
+	{
+		return Definition;
+	}
+
+	// 월드에 같은 타입의 픽업이 없어 등록되지 않았다면 정의 에셋에서 찾습니다
+	UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+	if (!AssetManager) return nullptr;
+
+	const FPrimaryAssetId AssetId(UInv_ItemDefinition::PrimaryAssetType, ItemType.GetTagName());
+	const UInv_ItemDefinition* ItemDefinition = Cast<UInv_ItemDefinition>(AssetManager->GetPrimaryAssetPath(AssetId).TryLoad());
+	if (!IsValid(ItemDefinition)) return nullptr;
+
+	return &Definitions.Add(ItemType, ItemDefinition->GetItemManifest());
+}
+
+bool UInv_ItemDefinitionRegistry::BuildManifest(const FInv_ItemInstanceData& InstanceData, FInv_ItemManifest& OutManifest)
+{
+	const FInv_ItemManifest* Definition = FindDefinition(InstanceData.ItemType);
+	if (!Definition)
+	{
+		UE_LOG(LogInventory, Log, TEXT("No item definition registered for %s"), *InstanceData.ItemType.ToString());
+		return false;
+	}
+
+	OutManifest = *Definition;
+	OutManifest.ApplyInstanceData(InstanceData);
+	return true;
+}
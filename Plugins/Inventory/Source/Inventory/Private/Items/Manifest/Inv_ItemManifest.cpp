@@ -3,22 +3,28 @@
 #include "Items/Inv_InventoryItem.h"
 #include "Items/Components/Inv_ItemComponent.h"
 #include "Items/Fragments/Inv_ItemFragment.h"
-#include "Widgets/Composite/Inv_CompositeBase.h"
+#include "UObject/CoreNet.h"
+#include "Widgets/ItemDescription/Inv_ItemDescriptionPayload.h"
 
 UInv_InventoryItem* FInv_ItemManifest::Manifest(UObject* NewOuter)
 {
 	// 새로운 인벤토리 아이템 객체를 생성합니다
 	UInv_InventoryItem* Item = NewObject<UInv_InventoryItem>(NewOuter, UInv_InventoryItem::StaticClass());
 
-	// 아이템에 이 매니페스트를 설정합니다
-	Item->SetItemManifest(*this);
+	// 처음 만들어지는 아이템이면 롤 시드를 정합니다 (0은 롤하지 않은 매니페스트를 뜻하므로 피함)
+	// 드롭했다가 다시 주운 아이템은 기존 시드를 유지합니다
+	while (RollSeed == 0)
+	{
+		RollSeed = static_cast<int32>(FMath::Rand32());
+	}
 
 	// 각 프래그먼트의 Manifest() 메서드를 호출하여 초기화합니다
 	// 예: FInv_LabeledNumberFragment의 경우 Min~Max 범위에서 랜덤 값 생성
-	for (auto& Fragment : Item->GetItemManifestMutable().GetFragmentsMutable())
-	{
-		Fragment.GetMutable().Manifest();
-	}
+	RollFragments();
+
+	// 아이템에 이 매니페스트를 설정합니다
+	// 롤 시드가 정해진 뒤에 설정해야 복제 데이터에 시드가 담깁니다
+	Item->SetItemManifest(*this);
 
 	// 매니페스트의 프래그먼트 데이터를 정리합니다 (아이템에 복사되었으므로)
 	ClearFragments();
@@ -26,31 +32,62 @@ UInv_InventoryItem* FInv_ItemManifest::Manifest(UObject* NewOuter)
 	return Item;
 }
 
+FInv_ItemInstanceData FInv_ItemManifest::MakeInstanceData() const
+{
+	FInv_ItemInstanceData InstanceData;
+	InstanceData.ItemType = ItemType;
+	InstanceData.RollSeed = RollSeed;
+
+	if (const FInv_StackableFragment* StackableFragment = GetFragmentOfType<FInv_StackableFragment>())
+	{
+		InstanceData.StackCount = StackableFragment->GetStackCount();
+	}
+	return InstanceData;
+}
+
+void FInv_ItemManifest::ApplyInstanceData(const FInv_ItemInstanceData& InstanceData)
+{
+	// 정의를 찾지 못해 빈 매니페스트에 적용하는 경우에도 아이템 타입은 유지합니다
+	ItemType = InstanceData.ItemType;
+
+	// 서버와 같은 시드로 롤하면 같은 수치가 나옵니다
+	RollSeed = InstanceData.RollSeed;
+	if (RollSeed != 0)
+	{
+		RollFragments();
+	}
+
+	if (FInv_StackableFragment* StackableFragment = GetFragmentOfTypeMutable<FInv_StackableFragment>())
+	{
+		StackableFragment->SetStackCount(InstanceData.StackCount);
+	}
+}
+
 /**
  * 이 매니페스트의 모든 인벤토리 아이템 프래그먼트를 컴포지트 위젯에 동화시킵니다
  *
  * 동작 방식:
- * 1. GetAllFragmentsOfType을 사용하여 모든 FInv_InventoryItemFragment 타입의 프래그먼트를 가져옵니다
- * 2. 각 프래그먼트에 대해 컴포지트 위젯 계층 구조를 순회합니다
- * 3. 각 위젯에 대해 Assimilate 함수를 호출하여 프래그먼트 데이터를 동화시킵니다
+ * 1. 모든 프래그먼트를 설명 페이로드에 동화시킵니다 (BuildDescriptionPayload)
+ * 2. 페이로드의 각 항목을 컴포지트의 태그 인덱스에서 찾은 위젯에만 적용합니다
+ * 3. 이전 동화에서 확장되었지만 이번에 동화되지 않은 위젯만 축소합니다 (전체를 축소했다 다시 확장하지 않음)
  *
  * 이를 통해 아이템의 모든 관련 프래그먼트 데이터가 UI 위젯 계층에 반영됩니다
  * 예: 아이템 이름 프래그먼트가 제목 위젯에, 설명 프래그먼트가 본문 위젯에 동화됨
+ * 아이템이 있다면 캐시된 UInv_InventoryItem::GetDescriptionPayload를 적용하는 것이 더 저렴합니다
  */
 void FInv_ItemManifest::AssimilateInventoryFragments(UInv_CompositeBase* Composite) const
 {
-	// 모든 인벤토리 아이템 프래그먼트를 가져옵니다
-	const auto& InventoryItemFragments = GetAllFragmentsOfType<FInv_InventoryItemFragment>();
+	FInv_ItemDescriptionPayload Payload;
+	BuildDescriptionPayload(Payload);
+	Payload.ApplyTo(Composite);
+}
 
-	// 각 프래그먼트에 대해
-	for (const auto* Fragment : InventoryItemFragments)
+void FInv_ItemManifest::BuildDescriptionPayload(FInv_ItemDescriptionPayload& OutPayload) const
+{
+	// 모든 인벤토리 아이템 프래그먼트를 순서대로 동화시킵니다
+	for (const auto* Fragment : GetAllFragmentsOfType<FInv_InventoryItemFragment>())
 	{
-		// 컴포지트 위젯 계층 구조의 모든 위젯에 함수를 적용합니다
-		Composite->ApplyFunction([Fragment](UInv_CompositeBase* Widget)
-		{
-			// 프래그먼트를 위젯에 동화시킵니다
-			Fragment->Assimilate(Widget);
-		});
+		Fragment->Assimilate(OutPayload);
 	}
 }
 
@@ -75,6 +112,74 @@ void FInv_ItemManifest::SpawnPickupActor(const UObject* WorldContextObject, cons
 	ItemComp->InitItemManifest(*this);
 }
 
+bool FInv_ItemManifest::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	NetSerializeFragmentArray(Fragments, Ar, Map, bOutSuccess);
+	if (Ar.IsError())
+	{
+		bOutSuccess = false;
+		return true;
+	}
+
+	uint32 Category = static_cast<uint32>(ItemCategory);
+	Ar.SerializeInt(Category, static_cast<uint32>(EInv_ItemCategory::None) + 1);
+	ItemCategory = static_cast<EInv_ItemCategory>(Category);
+
+	// 태그 직렬화가 앞선 실패를 덮어쓰지 않도록 결과를 따로 받습니다
+	bool bItemTypeSuccess = true;
+	ItemType.NetSerialize(Ar, Map, bItemTypeSuccess);
+	bOutSuccess &= bItemTypeSuccess;
+
+	// 롤하지 않은 매니페스트는 시드를 보내지 않습니다
+	uint8 bHasRollSeed = RollSeed != 0;
+	Ar.SerializeBits(&bHasRollSeed, 1);
+	if (bHasRollSeed)
+	{
+		Ar << RollSeed;
+	}
+	else if (Ar.IsLoading())
+	{
+		RollSeed = 0;
+	}
+
+	// 클래스 참조는 아카이브의 오브젝트 직렬화로 보냅니다 (네트 아카이브는 패키지 맵의 네트 GUID로 보냄)
+	UObject* PickupClassObject = PickupActorClass.Get();
+	Ar << PickupClassObject;
+	if (Ar.IsLoading())
+	{
+		PickupActorClass = Cast<UClass>(PickupClassObject);
+	}
+	bOutSuccess &= !Ar.IsError();
+	return true;
+}
+
+bool FInv_ItemInstanceData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	ItemType.NetSerialize(Ar, Map, bOutSuccess);
+
+	// 픽업에 배치된 매니페스트처럼 롤하지 않은 경우 시드를 보내지 않습니다
+	uint8 bHasRollSeed = RollSeed != 0;
+	Ar.SerializeBits(&bHasRollSeed, 1);
+	if (bHasRollSeed)
+	{
+		Ar << RollSeed;
+	}
+	else if (Ar.IsLoading())
+	{
+		RollSeed = 0;
+	}
+
+	uint32 PackedStackCount = static_cast<uint32>(FMath::Max(StackCount, 0));
+	Ar.SerializeIntPacked(PackedStackCount);
+	StackCount = static_cast<int32>(PackedStackCount);
+	bOutSuccess &= !Ar.IsError();
+	return true;
+}
+
 /**
  * 프래그먼트 배열을 비우고 메모리를 해제합니다
  *
@@ -92,3 +197,12 @@ void FInv_ItemManifest::ClearFragments()
 	// 프래그먼트 배열을 비우고 메모리를 해제합니다
 	Fragments.Empty();
 }
+
+void FInv_ItemManifest::RollFragments()
+{
+	FRandomStream RandomStream(RollSeed);
+	for (auto& Fragment : Fragments)
+	{
+		Fragment.GetMutable().Manifest(RandomStream);
+	}
+}
@@ -11,6 +11,8 @@
 #include "Items/Components/Inv_ItemComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Widgets/HUD/Inv_HUDWidget.h"
+#include "Widgets/Inventory/InventoryBase/Inv_InventoryBase.h"
+#include "Widgets/Utils/Inv_IconStreamingSubsystem.h"
 
 AInv_PlayerController::AInv_PlayerController()
 {
@@ -70,6 +72,12 @@ void AInv_PlayerController::SetupInputComponent()
 
 	// 인벤토리 토글 액션 바인딩
 	EnhancedInputComponent->BindAction(ToggleInventoryAction, ETriggerEvent::Started, this, &ThisClass::ToggleInventoryMenu);
+
+	// 아이템 회전 액션 바인딩 (설정된 경우에만)
+	if (IsValid(RotateItemAction))
+	{
+		EnhancedInputComponent->BindAction(RotateItemAction, ETriggerEvent::Started, this, &ThisClass::RotateHoverItem);
+	}
 }
 
 void AInv_PlayerController::Tick(float DeltaTime)
@@ -93,6 +101,16 @@ void AInv_PlayerController::PrimaryInteract()
 	InventoryComponent->TryAddItem(ItemComponent);
 }
 
+void AInv_PlayerController::RotateHoverItem()
+{
+	if (!InventoryComponent.IsValid() || !InventoryComponent->IsMenuOpen()) return;
+
+	if (UInv_InventoryBase* InventoryMenu = InventoryComponent->GetInventoryMenu(); IsValid(InventoryMenu))
+	{
+		InventoryMenu->RotateHoverItem();
+	}
+}
+
 void AInv_PlayerController::CreateHUDWidget()
 {
 	// 로컬 플레이어인 경우에만 HUD 생성
@@ -155,6 +173,9 @@ void AInv_PlayerController::TraceForItem()
 		if (!IsValid(ItemComponent)) return;
 
 		if (IsValid(HUDWidget)) HUDWidget->ShowPickupMessage(ItemComponent->GetPickupMessage());
+
+		// 주울 가능성이 높은 아이템이므로 인벤토리에 들어오기 전에 아이콘 스트리밍을 시작합니다
+		UInv_IconStreamingSubsystem::PrefetchItemIcon(this, ItemComponent->GetItemManifest());
 	}
 
 	// 이전 아이템의 하이라이트 비활성화
@@ -0,0 +1,360 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameFramework/Actor.h"
+#include "Items/Inv_ItemTag.h"
+#include "Items/Fragments/Inv_FragmentTags.h"
+#include "Items/Fragments/Inv_ItemFragment.h"
+#include "Items/Manifest/Inv_ItemManifest.h"
+#include "UObject/CoreNet.h"
+
+namespace
+{
+	/** 테스트 매니페스트를 구성하기 위해 비공개 프로퍼티를 리플렉션으로 가져옵니다 */
+	template<typename T>
+	T& GetPropertyValue(const UStruct* Struct, void* Container, const FName PropertyName)
+	{
+		const FProperty* Property = FindFProperty<FProperty>(Struct, PropertyName);
+		check(Property);
+		return *Property->ContainerPtrToValuePtr<T>(Container);
+	}
+
+	/**
+	 * 자동화 테스트용 네트 비트 아카이브
+	 * 네트 드라이버 없이 오브젝트 참조를 직렬화할 수 있도록, 이미 내보낸 네트 GUID처럼 오브젝트 테이블의 인덱스를 가변 길이로 보냅니다
+	 * 쓰기와 읽기에 같은 테이블을 사용해야 합니다 (인덱스 0은 nullptr)
+	 */
+	class FInv_TestNetBitWriter : public FNetBitWriter
+	{
+	public:
+		FInv_TestNetBitWriter(TArray<UObject*>& InObjectTable, const int64 InMaxBits)
+			: FNetBitWriter(nullptr, InMaxBits)
+			, ObjectTable(InObjectTable)
+		{
+		}
+
+		using FNetBitWriter::operator<<;
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			uint32 ObjectIndex = Object ? static_cast<uint32>(ObjectTable.AddUnique(Object)) + 1 : 0;
+			SerializeIntPacked(ObjectIndex);
+			return *this;
+		}
+
+	private:
+		TArray<UObject*>& ObjectTable;
+	};
+
+	/** FInv_TestNetBitWriter가 쓴 비트를 같은 오브젝트 테이블로 읽습니다 */
+	class FInv_TestNetBitReader : public FNetBitReader
+	{
+	public:
+		FInv_TestNetBitReader(TArray<UObject*>& InObjectTable, uint8* Src, const int64 CountBits)
+			: FNetBitReader(nullptr, Src, CountBits)
+			, ObjectTable(InObjectTable)
+		{
+		}
+
+		using FNetBitReader::operator<<;
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			uint32 ObjectIndex = 0;
+			SerializeIntPacked(ObjectIndex);
+			const int32 TableIndex = static_cast<int32>(ObjectIndex) - 1;
+			Object = ObjectTable.IsValidIndex(TableIndex) ? ObjectTable[TableIndex] : nullptr;
+			return *this;
+		}
+
+	private:
+		TArray<UObject*>& ObjectTable;
+	};
+
+	void NetSerializeGenericStruct(const UStruct* Struct, void* Container, FArchive& Ar);
+
+	/**
+	 * 일반 프로퍼티 복제가 보내는 방식대로 값 하나를 직렬화합니다 (비트 수 비교용, 쓰기 전용)
+	 * - 동적 배열은 복제 레이아웃처럼 16비트 길이 뒤에 요소를 보냅니다
+	 * - 인스턴스 구조체는 FInstancedStruct::NetSerialize처럼 유효 비트와 구조체 타입 참조 뒤에 내용을 보냅니다
+	 * - 네이티브 NetSerialize가 없는 구조체는 리프 프로퍼티까지 펼쳐 각 프로퍼티의 NetSerializeItem으로 보냅니다
+	 */
+	void NetSerializeGenericValue(const FProperty* Property, void* Data, FArchive& Ar)
+	{
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
+			uint16 ArrayNum = static_cast<uint16>(ArrayHelper.Num());
+			Ar << ArrayNum;
+			for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			{
+				NetSerializeGenericValue(ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), Ar);
+			}
+			return;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				FInstancedStruct& InstancedStruct = *static_cast<FInstancedStruct*>(Data);
+				uint8 bValidData = InstancedStruct.IsValid();
+				Ar.SerializeBits(&bValidData, 1);
+				if (bValidData)
+				{
+					UObject* ScriptStruct = const_cast<UScriptStruct*>(InstancedStruct.GetScriptStruct());
+					Ar << ScriptStruct;
+					NetSerializeGenericStruct(InstancedStruct.GetScriptStruct(), InstancedStruct.GetMutableMemory(), Ar);
+				}
+				return;
+			}
+
+			if ((StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative) == 0)
+			{
+				NetSerializeGenericStruct(StructProperty->Struct, Data, Ar);
+				return;
+			}
+		}
+
+		// 오브젝트 참조는 패키지 맵의 네트 GUID로 보내므로 테스트 아카이브의 오브젝트 직렬화를 사용합니다
+		const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+		if (ObjectProperty && !Property->IsA<FSoftObjectProperty>())
+		{
+			UObject* Object = ObjectProperty->GetObjectPropertyValue(Data);
+			Ar << Object;
+			return;
+		}
+
+		Property->NetSerializeItem(Ar, nullptr, Data);
+	}
+
+	void NetSerializeGenericStruct(const UStruct* Struct, void* Container, FArchive& Ar)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_RepSkip)) continue;
+
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				NetSerializeGenericValue(*It, It->ContainerPtrToValuePtr<void>(Container, ArrayIndex), Ar);
+			}
+		}
+	}
+
+	/** 그리드, 이름, 라벨 수치, 스택 프래그먼트를 가진 롤하지 않은 정의를 만듭니다 */
+	FInv_ItemManifest MakeTestDefinition(const float StatMin, const float StatMax, const int32 StatFractionalDigits)
+	{
+		FInv_ItemManifest Manifest;
+		const UScriptStruct* ManifestStruct = FInv_ItemManifest::StaticStruct();
+		GetPropertyValue<EInv_ItemCategory>(ManifestStruct, &Manifest, TEXT("ItemCategory")) = EInv_ItemCategory::Craftable;
+		GetPropertyValue<TSubclassOf<AActor>>(ManifestStruct, &Manifest, TEXT("PickupActorClass")) = AActor::StaticClass();
+
+		TArray<TInstancedStruct<FInv_ItemFragment>>& Fragments = Manifest.GetFragmentsMutable();
+
+		TInstancedStruct<FInv_ItemFragment>& Grid = Fragments.Add_GetRef(TInstancedStruct<FInv_ItemFragment>::Make<FInv_GridFragment>());
+		FInv_GridFragment& GridFragment = Grid.GetMutable<FInv_GridFragment>();
+		GridFragment.SetFragmentTag(FragmentTags::GridFragment);
+		GridFragment.SetGridSize(FIntPoint(2, 3));
+		GridFragment.SetGridPadding(2.5f);
+		GetPropertyValue<bool>(FInv_GridFragment::StaticStruct(), &GridFragment, TEXT("bRotatable")) = true;
+
+		TInstancedStruct<FInv_ItemFragment>& Name = Fragments.Add_GetRef(TInstancedStruct<FInv_ItemFragment>::Make<FInv_TextFragment>());
+		FInv_TextFragment& NameFragment = Name.GetMutable<FInv_TextFragment>();
+		NameFragment.SetFragmentTag(FragmentTags::ItemNameFragment);
+		NameFragment.SetText(INVTEXT("Fire Fern Fruit"));
+
+		TInstancedStruct<FInv_ItemFragment>& Stat = Fragments.Add_GetRef(TInstancedStruct<FInv_ItemFragment>::Make<FInv_LabeledNumberFragment>());
+		FInv_LabeledNumberFragment& StatFragment = Stat.GetMutable<FInv_LabeledNumberFragment>();
+		const UScriptStruct* StatStruct = FInv_LabeledNumberFragment::StaticStruct();
+		StatFragment.SetFragmentTag(FragmentTags::PrimaryStatFragment);
+		GetPropertyValue<FText>(StatStruct, &StatFragment, TEXT("Text_Label")) = INVTEXT("Heat");
+		GetPropertyValue<float>(StatStruct, &StatFragment, TEXT("Min")) = StatMin;
+		GetPropertyValue<float>(StatStruct, &StatFragment, TEXT("Max")) = StatMax;
+		GetPropertyValue<int32>(StatStruct, &StatFragment, TEXT("MaxFractionalDigits")) = StatFractionalDigits;
+
+		TInstancedStruct<FInv_ItemFragment>& Stackable = Fragments.Add_GetRef(TInstancedStruct<FInv_ItemFragment>::Make<FInv_StackableFragment>());
+		FInv_StackableFragment& StackableFragment = Stackable.GetMutable<FInv_StackableFragment>();
+		StackableFragment.SetFragmentTag(FragmentTags::StackableFragment);
+		GetPropertyValue<int32>(FInv_StackableFragment::StaticStruct(), &StackableFragment, TEXT("MaxStackSize")) = 20;
+		return Manifest;
+	}
+
+	/** 테스트에 사용하는 복제 데이터 (타입, 시드, 스택 수량) */
+	FInv_ItemInstanceData MakeTestInstanceData()
+	{
+		FInv_ItemInstanceData InstanceData;
+		InstanceData.ItemType = GameItems::Craftables::FireFernFruit;
+		InstanceData.RollSeed = 12345;
+		InstanceData.StackCount = 13;
+		return InstanceData;
+	}
+
+	/** 정의에 복제 데이터를 적용해 라벨 수치를 롤한 매니페스트를 만듭니다 */
+	FInv_ItemManifest MakeTestManifest()
+	{
+		FInv_ItemManifest Manifest = MakeTestDefinition(1.25f, 9.75f, 2);
+		Manifest.ApplyInstanceData(MakeTestInstanceData());
+		return Manifest;
+	}
+
+	/** 게임플레이 태그 하나를 직렬화한 비트 수 (Fast Replication 설정에 따라 달라짐) */
+	int64 GetTagBits(FGameplayTag Tag)
+	{
+		FNetBitWriter Writer(nullptr, 1024);
+		bool bOutSuccess = true;
+		Tag.NetSerialize(Writer, nullptr, bOutSuccess);
+		return Writer.GetNumBits();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInv_ItemManifestNetSerializeTest, "Inventory.Items.Manifest.NetSerialize",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInv_ItemManifestNetSerializeTest::RunTest(const FString& Parameters)
+{
+	TArray<UObject*> ObjectTable;
+	FInv_ItemManifest Manifest = MakeTestManifest();
+
+	// 직접 작성한 직렬화
+	FInv_TestNetBitWriter Writer(ObjectTable, 1 << 16);
+	bool bOutSuccess = false;
+	Manifest.NetSerialize(Writer, nullptr, bOutSuccess);
+	TestTrue(TEXT("Manifest serializes"), bOutSuccess && !Writer.IsError());
+	const int64 CustomBits = Writer.GetNumBits();
+
+	// 일반 프로퍼티 복제 경로 (프래그먼트마다 구조체 참조와 전체 크기 필드)
+	FInv_TestNetBitWriter GenericWriter(ObjectTable, 1 << 16);
+	NetSerializeGenericStruct(FInv_ItemManifest::StaticStruct(), &Manifest, GenericWriter);
+	TestFalse(TEXT("Generic path serializes"), GenericWriter.IsError());
+	const int64 GenericBits = GenericWriter.GetNumBits();
+
+	AddInfo(FString::Printf(TEXT("Manifest: %lld bits with NetSerialize, %lld bits with generic property replication."), CustomBits, GenericBits));
+	TestTrue(TEXT("NetSerialize is smaller than generic property replication"), CustomBits < GenericBits);
+
+	// 왕복 결과가 원본과 같아야 합니다
+	FInv_TestNetBitReader Reader(ObjectTable, Writer.GetData(), CustomBits);
+	FInv_ItemManifest ReadManifest;
+	bOutSuccess = false;
+	ReadManifest.NetSerialize(Reader, nullptr, bOutSuccess);
+	TestTrue(TEXT("Manifest deserializes"), bOutSuccess && !Reader.IsError());
+	TestEqual(TEXT("Reader consumed every bit"), Reader.GetPosBits(), CustomBits);
+
+	TestEqual(TEXT("Item type"), ReadManifest.GetItemType(), Manifest.GetItemType());
+	TestEqual(TEXT("Item category"), ReadManifest.GetItemCategory(), Manifest.GetItemCategory());
+	TestEqual(TEXT("Roll seed"), ReadManifest.GetRollSeed(), Manifest.GetRollSeed());
+	const UScriptStruct* ManifestStruct = FInv_ItemManifest::StaticStruct();
+	TestTrue(TEXT("Pickup actor class"), GetPropertyValue<TSubclassOf<AActor>>(ManifestStruct, &ReadManifest, TEXT("PickupActorClass")).Get() == AActor::StaticClass());
+
+	const TArray<TInstancedStruct<FInv_ItemFragment>>& Fragments = Manifest.GetFragmentsMutable();
+	const TArray<TInstancedStruct<FInv_ItemFragment>>& ReadFragments = ReadManifest.GetFragmentsMutable();
+	if (!TestEqual(TEXT("Fragment count"), ReadFragments.Num(), Fragments.Num())) return false;
+	for (int32 i = 0; i < Fragments.Num(); ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Fragment %d type"), i), ReadFragments[i].GetScriptStruct() == Fragments[i].GetScriptStruct());
+		TestEqual(FString::Printf(TEXT("Fragment %d tag"), i), ReadFragments[i].Get().GetFragmentTag(), Fragments[i].Get().GetFragmentTag());
+	}
+
+	const FInv_GridFragment* GridFragment = ReadManifest.GetFragmentOfType<FInv_GridFragment>();
+	if (!TestNotNull(TEXT("Grid fragment"), GridFragment)) return false;
+	TestEqual(TEXT("Grid size"), GridFragment->GetGridSize(), FIntPoint(2, 3));
+	TestEqual(TEXT("Grid padding"), GridFragment->GetGridPadding(), 2.5f);
+
+	const FInv_TextFragment* NameFragment = ReadManifest.GetFragmentOfType<FInv_TextFragment>();
+	if (!TestNotNull(TEXT("Name fragment"), NameFragment)) return false;
+	TestEqual(TEXT("Name text"), NameFragment->GetText().ToString(), FString(TEXT("Fire Fern Fruit")));
+
+	// 표시 값은 MaxFractionalDigits(2) 자릿수로 양자화되고, 롤 범위는 그대로 도착합니다
+	const FInv_LabeledNumberFragment* StatFragment = Manifest.GetFragmentOfType<FInv_LabeledNumberFragment>();
+	const FInv_LabeledNumberFragment* ReadStatFragment = ReadManifest.GetFragmentOfType<FInv_LabeledNumberFragment>();
+	if (!TestNotNull(TEXT("Stat fragment"), ReadStatFragment)) return false;
+	const float QuantizedValue = static_cast<float>(FMath::RoundToDouble(StatFragment->GetValue() * 100.0) / 100.0);
+	TestEqual(TEXT("Stat value is quantized to two digits"), ReadStatFragment->GetValue(), QuantizedValue, 1.e-4f);
+	TestEqual(TEXT("Stat value is within the quantization step"), ReadStatFragment->GetValue(), StatFragment->GetValue(), 0.005f + 1.e-4f);
+	TestFalse(TEXT("Rolled stat is not randomized again"), ReadStatFragment->bRandomizeOnManifest);
+	const UScriptStruct* StatStruct = FInv_LabeledNumberFragment::StaticStruct();
+	FInv_LabeledNumberFragment& MutableReadStat = const_cast<FInv_LabeledNumberFragment&>(*ReadStatFragment);
+	TestEqual(TEXT("Stat min"), GetPropertyValue<float>(StatStruct, &MutableReadStat, TEXT("Min")), 1.25f);
+	TestEqual(TEXT("Stat max"), GetPropertyValue<float>(StatStruct, &MutableReadStat, TEXT("Max")), 9.75f);
+	TestEqual(TEXT("Stat label"), GetPropertyValue<FText>(StatStruct, &MutableReadStat, TEXT("Text_Label")).ToString(), FString(TEXT("Heat")));
+
+	const FInv_StackableFragment* StackableFragment = ReadManifest.GetFragmentOfType<FInv_StackableFragment>();
+	if (!TestNotNull(TEXT("Stackable fragment"), StackableFragment)) return false;
+	TestEqual(TEXT("Max stack size"), StackableFragment->GetMaxStackSize(), 20);
+	TestEqual(TEXT("Stack count"), StackableFragment->GetStackCount(), 13);
+
+	// 스택 수량은 MaxStackSize를 표현하는 비트만 사용합니다 (타입 인덱스 + 태그 + 가변 길이 최대 크기 + 초과 비트 + 수량)
+	TInstancedStruct<FInv_ItemFragment> Stackable = Manifest.GetFragmentsMutable().Last();
+	FInv_TestNetBitWriter StackableWriter(ObjectTable, 1024);
+	bOutSuccess = true;
+	NetSerializeInstancedFragment(Stackable, StackableWriter, nullptr, bOutSuccess);
+	const int64 FragmentTagBits = GetTagBits(FragmentTags::StackableFragment);
+	const int64 MaxStackableBits = FMath::CeilLogTwo(MaxBuiltInFragmentTypes) + FragmentTagBits + 8 + 1 + FMath::CeilLogTwo(20 + 1);
+	AddInfo(FString::Printf(TEXT("Stackable fragment: %lld bits."), StackableWriter.GetNumBits()));
+	TestTrue(TEXT("Stackable fragment packs the stack count"), StackableWriter.GetNumBits() <= MaxStackableBits);
+
+	// 복제 데이터는 태그, 시드 비트, 32비트 시드, 가변 길이 스택 수량만 보냅니다
+	FInv_ItemInstanceData InstanceData = Manifest.MakeInstanceData();
+	FInv_TestNetBitWriter InstanceWriter(ObjectTable, 1024);
+	bOutSuccess = false;
+	InstanceData.NetSerialize(InstanceWriter, nullptr, bOutSuccess);
+	const int64 InstanceBits = InstanceWriter.GetNumBits();
+	AddInfo(FString::Printf(TEXT("Instance data: %lld bits."), InstanceBits));
+	TestEqual(TEXT("Instance data bit count"), InstanceBits, GetTagBits(InstanceData.ItemType) + 1 + 32 + 8);
+	TestTrue(TEXT("Instance data is smaller than the manifest"), InstanceBits < CustomBits);
+
+	FInv_TestNetBitReader InstanceReader(ObjectTable, InstanceWriter.GetData(), InstanceBits);
+	FInv_ItemInstanceData ReadInstanceData;
+	ReadInstanceData.NetSerialize(InstanceReader, nullptr, bOutSuccess);
+	TestTrue(TEXT("Instance data deserializes"), bOutSuccess && !InstanceReader.IsError());
+	TestEqual(TEXT("Instance item type"), ReadInstanceData.ItemType, InstanceData.ItemType);
+	TestEqual(TEXT("Instance roll seed"), ReadInstanceData.RollSeed, 12345);
+	TestEqual(TEXT("Instance stack count"), ReadInstanceData.StackCount, 13);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInv_ItemDefinitionRerollTest, "Inventory.Items.Manifest.DefinitionReroll",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInv_ItemDefinitionRerollTest::RunTest(const FString& Parameters)
+{
+	TArray<UObject*> ObjectTable;
+
+	// 롤 범위가 표시 자릿수(1)로 표현되지 않는 정의를 서버가 클라이언트로 보냅니다
+	const float StatMin = 1.23457f;
+	const float StatMax = 9.87654f;
+	FInv_ItemManifest Definition = MakeTestDefinition(StatMin, StatMax, 1);
+
+	FInv_TestNetBitWriter Writer(ObjectTable, 1 << 16);
+	bool bOutSuccess = false;
+	Definition.NetSerialize(Writer, nullptr, bOutSuccess);
+	TestTrue(TEXT("Definition serializes"), bOutSuccess && !Writer.IsError());
+
+	FInv_TestNetBitReader Reader(ObjectTable, Writer.GetData(), Writer.GetNumBits());
+	FInv_ItemManifest ReceivedDefinition;
+	bOutSuccess = false;
+	ReceivedDefinition.NetSerialize(Reader, nullptr, bOutSuccess);
+	TestTrue(TEXT("Definition deserializes"), bOutSuccess && !Reader.IsError());
+
+	const FInv_LabeledNumberFragment* ReceivedStat = ReceivedDefinition.GetFragmentOfType<FInv_LabeledNumberFragment>();
+	if (!TestNotNull(TEXT("Received stat fragment"), ReceivedStat)) return false;
+	const UScriptStruct* StatStruct = FInv_LabeledNumberFragment::StaticStruct();
+	FInv_LabeledNumberFragment& MutableReceivedStat = const_cast<FInv_LabeledNumberFragment&>(*ReceivedStat);
+	TestEqual(TEXT("Stat min keeps full precision"), GetPropertyValue<float>(StatStruct, &MutableReceivedStat, TEXT("Min")), StatMin, 0.f);
+	TestEqual(TEXT("Stat max keeps full precision"), GetPropertyValue<float>(StatStruct, &MutableReceivedStat, TEXT("Max")), StatMax, 0.f);
+	TestTrue(TEXT("Received definition is still unrolled"), ReceivedStat->bRandomizeOnManifest);
+
+	// 서버와 클라이언트가 같은 복제 데이터로 각자 롤한 수치가 정확히 같아야 합니다
+	const FInv_ItemInstanceData InstanceData = MakeTestInstanceData();
+	Definition.ApplyInstanceData(InstanceData);
+	ReceivedDefinition.ApplyInstanceData(InstanceData);
+
+	const FInv_LabeledNumberFragment* ServerStat = Definition.GetFragmentOfType<FInv_LabeledNumberFragment>();
+	const FInv_LabeledNumberFragment* ClientStat = ReceivedDefinition.GetFragmentOfType<FInv_LabeledNumberFragment>();
+	if (!TestNotNull(TEXT("Server stat fragment"), ServerStat) || !TestNotNull(TEXT("Client stat fragment"), ClientStat)) return false;
+	TestEqual(TEXT("Client roll matches the server roll"), ClientStat->GetValue(), ServerStat->GetValue(), 0.f);
+	TestEqual(TEXT("Client stack count"), ReceivedDefinition.GetFragmentOfType<FInv_StackableFragment>()->GetStackCount(), 13);
+	return true;
+}
+
+#endif
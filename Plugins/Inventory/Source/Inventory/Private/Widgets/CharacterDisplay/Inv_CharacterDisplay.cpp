@@ -48,10 +48,9 @@ void UInv_CharacterDisplay::NativeOnInitialized()
     Mesh = ProxyMesh->GetMesh();
 }
 
-void UInv_CharacterDisplay::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+FReply UInv_CharacterDisplay::NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
 {
-    Super::NativeTick(MyGeometry, InDeltaTime);
-    if (!bIsDragging) return;
+    if (!bIsDragging) return Super::NativeOnMouseMove(InGeometry, InMouseEvent);
 
     // 마우스 이동 거리 계산
     LastPosition = CurrentPosition;
@@ -60,6 +59,9 @@ void UInv_CharacterDisplay::NativeTick(const FGeometry& MyGeometry, float InDelt
     const float HorizontalDelta = LastPosition.X - CurrentPosition.X;
 
     // 메시를 Yaw축으로 회전 (좌우 드래그에 따라 캐릭터 회전)
-    if (!Mesh.IsValid()) return;
-    Mesh->AddRelativeRotation(FRotator(0.f, HorizontalDelta, 0.f));
+    if (Mesh.IsValid())
+    {
+        Mesh->AddRelativeRotation(FRotator(0.f, HorizontalDelta, 0.f));
+    }
+    return FReply::Handled();
 }
\ No newline at end of file
@@ -17,6 +17,59 @@ void UInv_Composite::NativeOnInitialized()
             Composite->Collapse();
         }
     });
+
+    // 하위 컴포지트는 이미 초기화되어 자식 목록을 가지고 있으므로 리프 인덱스를 한 번 만듭니다
+    AddLeavesToIndex(this);
+}
+
+void UInv_Composite::AddLeavesToIndex(const UInv_Composite* Composite)
+{
+    for (const auto& Child : Composite->Children)
+    {
+        if (const UInv_Composite* ChildComposite = Cast<UInv_Composite>(Child))
+        {
+            AddLeavesToIndex(ChildComposite);
+            continue;
+        }
+        LeafIndex.FindOrAdd(Child->GetFragmentTag()).Add(Child);
+    }
+}
+
+void UInv_Composite::ForEachLeafWithTag(const FGameplayTag& Tag, TFunctionRef<void(UInv_CompositeBase*)> Function)
+{
+    const TArray<TObjectPtr<UInv_CompositeBase>>* Leaves = LeafIndex.Find(Tag);
+    if (!Leaves) return;
+
+    for (const auto& Leaf : *Leaves)
+    {
+        if (bAssimilating)
+        {
+            AssimilatedLeaves.Add(Leaf);
+        }
+        Function(Leaf);
+    }
+}
+
+void UInv_Composite::BeginAssimilation()
+{
+    bAssimilating = true;
+    AssimilatedLeaves.Reset();
+}
+
+void UInv_Composite::EndAssimilation()
+{
+    bAssimilating = false;
+
+    // 이번 동화에서 다시 확장되지 않은 리프만 축소합니다
+    for (const auto& Leaf : ExpandedLeaves)
+    {
+        if (!AssimilatedLeaves.Contains(Leaf))
+        {
+            Leaf->Collapse();
+        }
+    }
+    Swap(ExpandedLeaves, AssimilatedLeaves);
+    AssimilatedLeaves.Reset();
 }
 
 void UInv_Composite::ApplyFunction(FuncType Function) 
@@ -33,4 +86,5 @@ void UInv_Composite::Collapse()
     {
         Child->Collapse();
     }
+    ExpandedLeaves.Reset();
 }
@@ -5,10 +5,13 @@
 
 void UInv_CompositeBase::Collapse()
 {
+    // 가시성이 바뀔 때만 설정해 레이아웃을 다시 계산하지 않도록 합니다
+    if (GetVisibility() == ESlateVisibility::Collapsed) return;
     SetVisibility(ESlateVisibility::Collapsed);
 }
 
 void UInv_CompositeBase::Expand()
 {
+    if (GetVisibility() == ESlateVisibility::Visible) return;
     SetVisibility(ESlateVisibility::Visible);
 }
@@ -7,3 +7,9 @@ void UInv_Leaf::ApplyFunction(FuncType Function)
 {
     Function(this);
 }
+
+void UInv_Leaf::ForEachLeafWithTag(const FGameplayTag& Tag, TFunctionRef<void(UInv_CompositeBase*)> Function)
+{
+    if (!GetFragmentTag().MatchesTagExact(Tag)) return;
+    Function(this);
+}
@@ -4,11 +4,37 @@
 
 #include "Components/Image.h"
 #include "Components/SizeBox.h"
+#include "Engine/Texture2D.h"
+#include "Widgets/Utils/Inv_IconStreamingSubsystem.h"
 
-void UInv_Leaf_Image::SetImage(UTexture2D* Texture) const
+void UInv_Leaf_Image::SetImage(const TSoftObjectPtr<UTexture2D>& Texture)
 {
-	// 이미지 위젯에 텍스처를 설정합니다.
-	Image_Icon->SetBrushFromTexture(Texture);
+	// 이전 텍스처의 로드는 더 이상 필요 없습니다.
+	if (IconLoadHandle.IsValid())
+	{
+		IconLoadHandle->CancelHandle();
+		IconLoadHandle.Reset();
+	}
+
+	// 이미 로드된 텍스처는 바로 설정합니다. 같은 텍스처면 브러시를 다시 설정하지 않습니다.
+	if (UTexture2D* LoadedTexture = Texture.Get(); IsValid(LoadedTexture) || Texture.IsNull())
+	{
+		if (Image_Icon->GetBrush().GetResourceObject() != LoadedTexture)
+		{
+			Image_Icon->SetBrushFromTexture(LoadedTexture);
+		}
+		Image_Icon->SetRenderOpacity(1.f);
+		return;
+	}
+
+	// 로드되는 동안 이전 텍스처나 빈 브러시가 보이지 않도록 숨깁니다.
+	Image_Icon->SetRenderOpacity(0.f);
+	IconLoadHandle = UInv_IconStreamingSubsystem::RequestIcon(Texture, FStreamableDelegate::CreateWeakLambda(this, [this, Texture]()
+	{
+		IconLoadHandle.Reset();
+		Image_Icon->SetBrushFromTexture(Texture.Get());
+		Image_Icon->SetRenderOpacity(1.f);
+	}));
 }
 
 void UInv_Leaf_Image::SetBoxSize(const FVector2D& Size) const
@@ -13,6 +13,12 @@ void UInv_Leaf_LabeledValue::SetText_Label(const FText& Text, bool bCollapse) co
 		return;
 	}
 
+	// 이전 아이템에서 숨겨졌을 수 있으므로 다시 표시합니다
+	Text_Label->SetVisibility(ESlateVisibility::Visible);
+
+	// 같은 내용이면 설정하지 않아 텍스트 레이아웃을 다시 계산하지 않습니다
+	if (Text_Label->GetText().EqualTo(Text)) return;
+
 	// 라벨 텍스트를 설정합니다
 	Text_Label->SetText(Text);
 }
@@ -26,6 +32,12 @@ void UInv_Leaf_LabeledValue::SetText_Value(const FText& Text, bool bCollapse) co
 		return;
 	}
 
+	// 이전 아이템에서 숨겨졌을 수 있으므로 다시 표시합니다
+	Text_Value->SetVisibility(ESlateVisibility::Visible);
+
+	// 같은 내용이면 설정하지 않아 텍스트 레이아웃을 다시 계산하지 않습니다
+	if (Text_Value->GetText().EqualTo(Text)) return;
+
 	// 값 텍스트를 설정합니다
 	Text_Value->SetText(Text);
 }
@@ -6,6 +6,9 @@
 
 void UInv_Leaf_Text::SetText(const FText& Text) const
 {
+	// 같은 내용이면 설정하지 않아 텍스트 레이아웃을 다시 계산하지 않습니다.
+	if (Text_LeafText->GetText().EqualTo(Text)) return;
+
 	// 텍스트 블록에 텍스트를 설정합니다.
 	Text_LeafText->SetText(Text);
 }
@@ -13,6 +13,8 @@
 #include "Items/Fragments/Inv_ItemFragment.h"
 #include "Widgets/Inventory/HoverItem/Inv_HoverItem.h"
 #include "Widgets/Inventory/SlottedItems/Inv_EquippedSlottedItem.h"
+#include "Widgets/Pool/Inv_WidgetPoolSubsystem.h"
+#include "Widgets/Utils/Inv_IconBrushCache.h"
 
 /**
  * 마우스가 슬롯 위에 올라갔을 때 호출됩니다
@@ -126,7 +128,7 @@ FReply UInv_EquippedGridSlot::NativeOnMouseButtonDown(const FGeometry& InGeometr
  * 1. 장비 타입 태그 검증 (일치하지 않으면 실패)
  * 2. 아이템의 그리드 크기 정보 가져오기
  * 3. 위젯의 그리기 크기 계산
- * 4. 장착 아이템 위젯 생성 및 설정
+ * 4. 장착 아이템 위젯을 위젯 풀에서 꺼내 설정
  * 5. 아이템 이미지 브러시 설정
  * 6. 오버레이에 위젯 추가 및 중앙 정렬
  *
@@ -138,9 +140,10 @@ FReply UInv_EquippedGridSlot::NativeOnMouseButtonDown(const FGeometry& InGeometr
  * @param Item 장착할 인벤토리 아이템
  * @param EquipmentTag 장비 타입 태그 (검증용)
  * @param TileSize 타일 크기 (위젯 크기 계산에 사용)
+ * @param IconBrushCache 아이콘 브러시를 가져올 캐시
  * @return 생성된 장착 아이템 위젯 (실패 시 nullptr)
  */
-UInv_EquippedSlottedItem* UInv_EquippedGridSlot::OnItemEquipped(UInv_InventoryItem* Item, const FGameplayTag& EquipmentTag, float TileSize)
+UInv_EquippedSlottedItem* UInv_EquippedGridSlot::OnItemEquipped(UInv_InventoryItem* Item, const FGameplayTag& EquipmentTag, float TileSize, FInv_IconBrushCache& IconBrushCache)
 {
 
     // 장비 타입 태그 검증: 요청된 태그가 이 슬롯의 타입과 정확히 일치하는지 확인
@@ -157,8 +160,12 @@ UInv_EquippedSlottedItem* UInv_EquippedGridSlot::OnItemEquipped(UInv_InventoryIt
     const float IconTileWidth = TileSize - GridFragment->GetGridPadding() * 2;
     const FVector2D DrawSize = GridDimensions * IconTileWidth;
 
-    // 장착 아이템 위젯 생성
-    EquippedSlottedItem = CreateWidget<UInv_EquippedSlottedItem>(GetOwningPlayer(), EquippedSlottedItemClass);
+    // 아이템의 이미지 프래그먼트를 가져옵니다 (아이콘 설정에 필요)
+    const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(Item, FragmentTags::IconFragment);
+    if (!ImageFragment) return nullptr;
+
+    // 장착 아이템 위젯을 위젯 풀에서 꺼냅니다 (장착 해제 시 풀에 반환됨)
+    EquippedSlottedItem = UInv_WidgetPoolSubsystem::AcquireWidget<UInv_EquippedSlottedItem>(GetOwningPlayer(), EquippedSlottedItemClass);
 
     // 위젯에 인벤토리 아이템 데이터 설정
     EquippedSlottedItem->SetInventoryItem(Item);
@@ -172,18 +179,8 @@ UInv_EquippedSlottedItem* UInv_EquippedGridSlot::OnItemEquipped(UInv_InventoryIt
     // 이 슬롯에 아이템 참조 저장 (슬롯이 점유되었음을 표시)
     SetInventoryItem(Item);
 
-    // 아이템의 이미지 프래그먼트를 가져와서 아이콘 설정
-    const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(Item, FragmentTags::IconFragment);
-    if (!ImageFragment) return nullptr;
-
-    // Slate 브러시 생성 및 설정 (아이템 이미지 표시용)
-    FSlateBrush Brush;
-    Brush.SetResourceObject(ImageFragment->GetIcon());
-    Brush.DrawAs = ESlateBrushDrawType::Image;
-    Brush.ImageSize = DrawSize;
-
-    // 위젯에 이미지 브러시 적용
-    EquippedSlottedItem->SetImageBrush(Brush);
+    // 캐시된 이미지 브러시를 위젯에 적용 (크기는 DrawSize와 같음, 아이콘이 로드 중이면 자리 표시 브러시)
+    RefreshEquippedItemBrush(TileSize, IconBrushCache);
 
     // 생성된 장착 아이템 위젯을 이 슬롯의 오버레이에 추가
     Overlay_Root->AddChildToOverlay(EquippedSlottedItem);
@@ -205,3 +202,15 @@ UInv_EquippedSlottedItem* UInv_EquippedGridSlot::OnItemEquipped(UInv_InventoryIt
     // 생성되고 설정된 장착 아이템 위젯 반환
     return EquippedSlottedItem;
 }
+
+void UInv_EquippedGridSlot::RefreshEquippedItemBrush(float TileSize, FInv_IconBrushCache& IconBrushCache) const
+{
+    if (!IsValid(EquippedSlottedItem)) return;
+
+    const UInv_InventoryItem* Item = EquippedSlottedItem->GetInventoryItem();
+    const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(Item, FragmentTags::GridFragment);
+    const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(Item, FragmentTags::IconFragment);
+    if (!GridFragment || !ImageFragment) return;
+
+    EquippedSlottedItem->SetImageBrush(IconBrushCache.FindOrAdd(ImageFragment->GetIcon(), GridFragment->GetGridSize(), GridFragment->GetGridPadding(), TileSize));
+}
@@ -38,29 +38,69 @@ void UInv_GridSlot::SetInventoryItem(UInv_InventoryItem* Item)
 void UInv_GridSlot::SetOccupiedTexture()
 {
     // 슬롯 상태를 점유됨으로 변경하고 해당 브러시를 적용합니다
-    GridSlotState = EInv_GridSlotState::Occupied;
-    Image_GridSlot->SetBrush(Brush_Occupied);
+    ApplyGridSlotState(EInv_GridSlotState::Occupied);
 }
 
 void UInv_GridSlot::SetUnoccupiedTexture()
 {
     // 슬롯 상태를 비어있음으로 변경하고 해당 브러시를 적용합니다
-    GridSlotState = EInv_GridSlotState::Unoccupied;
-    Image_GridSlot->SetBrush(Brush_Unoccupied);
+    ApplyGridSlotState(EInv_GridSlotState::Unoccupied);
 }
 
 void UInv_GridSlot::SetSelectedTexture()
 {
     // 슬롯 상태를 선택됨으로 변경하고 해당 브러시를 적용합니다
-    GridSlotState = EInv_GridSlotState::Selected;
-    Image_GridSlot->SetBrush(Brush_Selected);
+    ApplyGridSlotState(EInv_GridSlotState::Selected);
 }
 
 void UInv_GridSlot::SetGrayedOutTexture()
 {
     // 슬롯 상태를 비활성화로 변경하고 해당 브러시를 적용합니다
-    GridSlotState = EInv_GridSlotState::GrayedOut;
-    Image_GridSlot->SetBrush(Brush_GrayedOut);
+    ApplyGridSlotState(EInv_GridSlotState::GrayedOut);
+}
+
+void UInv_GridSlot::SetGridSlotState(const EInv_GridSlotState State)
+{
+    switch (State)
+    {
+    case EInv_GridSlotState::Occupied:
+        SetOccupiedTexture();
+        break;
+    case EInv_GridSlotState::Unoccupied:
+        SetUnoccupiedTexture();
+        break;
+    case EInv_GridSlotState::GrayedOut:
+        SetGrayedOutTexture();
+        break;
+    case EInv_GridSlotState::Selected:
+        SetSelectedTexture();
+        break;
+    }
+}
+
+void UInv_GridSlot::ApplyGridSlotState(const EInv_GridSlotState State)
+{
+    // 이미 같은 상태의 브러시가 적용되어 있으면 다시 설정하지 않습니다 (SetBrush는 레이아웃과 페인트를 무효화합니다)
+    if (bGridSlotBrushApplied && GridSlotState == State) return;
+
+    GridSlotState = State;
+    Image_GridSlot->SetBrush(GetBrush(State));
+    bGridSlotBrushApplied = true;
+}
+
+const FSlateBrush& UInv_GridSlot::GetBrush(const EInv_GridSlotState State) const
+{
+    switch (State)
+    {
+    case EInv_GridSlotState::Occupied:
+        return Brush_Occupied;
+    case EInv_GridSlotState::Selected:
+        return Brush_Selected;
+    case EInv_GridSlotState::GrayedOut:
+        return Brush_GrayedOut;
+    default:
+        return Brush_Unoccupied;
+    }
 }
 
 void UInv_GridSlot::SetItemPopUp(UInv_ItemPopUp* PopUp)
@@ -77,5 +117,7 @@ UInv_ItemPopUp* UInv_GridSlot::GetItemPopUp() const
 
 void UInv_GridSlot::OnItemPopUpDestruct(UUserWidget* Menu)
 {
+    // 팝업은 풀에서 재사용되므로 다음에 다른 슬롯에 표시될 때를 위해 바인딩을 해제합니다
+    Menu->OnNativeDestruct.RemoveAll(this);
     ItemPopUp.Reset();
 }
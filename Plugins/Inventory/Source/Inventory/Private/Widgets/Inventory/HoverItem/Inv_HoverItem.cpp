@@ -7,6 +7,16 @@
 #include "Components/TextBlock.h"
 #include "Items/Inv_InventoryItem.h"
 
+void UInv_HoverItem::OnReleasedToPool_Implementation()
+{
+    SetInventoryItem(nullptr);
+    SetIsStackable(false);
+    SetPreviousGridIndex(INDEX_NONE);
+    SetRotated(false);
+    UpdateStackCount(0);
+    SetImageBrush(FSlateNoResource());
+}
+
 void UInv_HoverItem::SetImageBrush(const FSlateBrush& Brush) const
 {
     Image_Icon->SetBrush(Brush);
@@ -48,6 +58,14 @@ void UInv_HoverItem::SetIsStackable(bool bStacks)
     }
 }
 
+void UInv_HoverItem::SetRotated(bool bInRotated)
+{
+    bRotated = bInRotated;
+
+    // 아이콘은 원래 크기의 브러시를 유지하고 중심을 기준으로 회전합니다
+    Image_Icon->SetRenderTransformAngle(bRotated ? 90.f : 0.f);
+}
+
 UInv_InventoryItem* UInv_HoverItem::GetInventoryItem() const
 {
     return InventoryItem.Get();
@@ -26,3 +26,11 @@ FReply UInv_EquippedSlottedItem::NativeOnMouseButtonDown(const FGeometry& InGeom
     OnEquippedSlottedItemClicked.Broadcast(this);
     return FReply::Handled();
 }
+
+void UInv_EquippedSlottedItem::OnReleasedToPool_Implementation()
+{
+    Super::OnReleasedToPool_Implementation();
+
+    OnEquippedSlottedItemClicked.Clear();
+    EquipmentTypeTag = FGameplayTag();
+}
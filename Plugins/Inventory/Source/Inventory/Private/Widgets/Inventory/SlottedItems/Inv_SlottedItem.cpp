@@ -26,6 +26,19 @@ void UInv_SlottedItem::NativeOnMouseLeave(const FPointerEvent& MouseEvent)
 	UInv_InventoryStatics::ItemUnhovered(GetOwningPlayer());
 }
 
+void UInv_SlottedItem::OnReleasedToPool_Implementation()
+{
+	OnSlottedItemClicked.Clear();
+	InventoryItem.Reset();
+	GridIndex = INDEX_NONE;
+	bIsStackable = false;
+	UpdateStackCount(0);
+
+	// 회전 표시와 아이콘 텍스처 참조를 해제합니다
+	Image_Icon->SetRenderTransformAngle(0.f);
+	Image_Icon->SetBrush(FSlateNoResource());
+}
+
 void UInv_SlottedItem::SetInventoryItem(UInv_InventoryItem* Item)
 {
 	// 인벤토리 아이템에 대한 약한 참조를 설정합니다
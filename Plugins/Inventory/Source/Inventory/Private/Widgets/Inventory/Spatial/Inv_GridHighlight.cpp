@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Inventory/Spatial/Inv_GridHighlight.h"
+
+void UInv_GridHighlight::InitializeHighlight(const float InTileSize, const UInv_GridSlot* BrushSource)
+{
+	HighlightData->TileSize = InTileSize;
+	HighlightData->CellRect = FIntRect();
+	HighlightData->CellBrushes.Init(BrushSource, InTileSize);
+	InvalidateHighlight();
+}
+
+void UInv_GridHighlight::SetHighlight(const FIntRect& CellRect, const EInv_GridSlotState State)
+{
+	if (HighlightData->CellRect == CellRect && HighlightData->State == State) return;
+
+	HighlightData->CellRect = CellRect;
+	HighlightData->State = State;
+	InvalidateHighlight();
+}
+
+void UInv_GridHighlight::ClearHighlight()
+{
+	SetHighlight(FIntRect(), HighlightData->State);
+}
+
+void UInv_GridHighlight::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyGridHighlight.Reset();
+}
+
+TSharedRef<SWidget> UInv_GridHighlight::RebuildWidget()
+{
+	MyGridHighlight = SNew(SInv_GridHighlight)
+		.HighlightData(HighlightData);
+	return MyGridHighlight.ToSharedRef();
+}
+
+void UInv_GridHighlight::InvalidateHighlight() const
+{
+	if (MyGridHighlight.IsValid())
+	{
+		MyGridHighlight->Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Inventory/Spatial/Inv_GridRenderer.h"
+
+#include "Styling/CoreStyle.h"
+
+void UInv_GridRenderer::InitializeGrid(const int32 InColumns, const int32 InRows, const float InTileSize, const UInv_GridSlot* BrushSource, const FSlateFontInfo& StackCountFont)
+{
+	RenderData->Columns = FMath::Max(InColumns, 0);
+	RenderData->Rows = FMath::Max(InRows, 0);
+	RenderData->TileSize = InTileSize;
+	RenderData->CellStates.Init(EInv_GridSlotState::Unoccupied, RenderData->Columns * RenderData->Rows);
+	RenderData->Items.Reset();
+
+	RenderData->CellBrushes.Init(BrushSource, InTileSize);
+
+	// 폰트가 지정되지 않았으면 기본 폰트를 사용합니다
+	RenderData->StackCountFont = StackCountFont.HasValidFont() ? StackCountFont : FCoreStyle::GetDefaultFontStyle("Bold", 14);
+
+	InvalidateLayoutAndVolatility();
+	InvalidateRenderer();
+}
+
+void UInv_GridRenderer::SetCellState(const int32 CellIndex, const EInv_GridSlotState State)
+{
+	if (!RenderData->CellStates.IsValidIndex(CellIndex) || RenderData->CellStates[CellIndex] == State) return;
+
+	RenderData->CellStates[CellIndex] = State;
+	InvalidateRenderer();
+}
+
+void UInv_GridRenderer::AddItem(const int32 UpperLeftIndex, const FInv_GridRenderItem& Item)
+{
+	RenderData->Items.Add(UpperLeftIndex, Item);
+	InvalidateRenderer();
+}
+
+void UInv_GridRenderer::RemoveItem(const int32 UpperLeftIndex)
+{
+	if (RenderData->Items.Remove(UpperLeftIndex) > 0)
+	{
+		InvalidateRenderer();
+	}
+}
+
+void UInv_GridRenderer::SetItemStackCount(const int32 UpperLeftIndex, const int32 StackCount)
+{
+	FInv_GridRenderItem* Item = RenderData->Items.Find(UpperLeftIndex);
+	if (!Item || Item->StackCount == StackCount) return;
+
+	Item->StackCount = StackCount;
+	InvalidateRenderer();
+}
+
+void UInv_GridRenderer::ClearItems()
+{
+	if (RenderData->Items.IsEmpty()) return;
+
+	RenderData->Items.Reset();
+	InvalidateRenderer();
+}
+
+void UInv_GridRenderer::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyGridRenderer.Reset();
+}
+
+TSharedRef<SWidget> UInv_GridRenderer::RebuildWidget()
+{
+	MyGridRenderer = SNew(SInv_GridRenderer)
+		.RenderData(RenderData)
+		.OnCellClicked(FInv_GridCellClicked::CreateUObject(this, &ThisClass::HandleCellClicked))
+		.OnHoveredCellChanged(FInv_GridHoveredCellChanged::CreateUObject(this, &ThisClass::HandleHoveredCellChanged));
+	return MyGridRenderer.ToSharedRef();
+}
+
+void UInv_GridRenderer::InvalidateRenderer() const
+{
+	if (MyGridRenderer.IsValid())
+	{
+		MyGridRenderer->Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void UInv_GridRenderer::HandleCellClicked(int32 CellIndex, const FPointerEvent& MouseEvent) const
+{
+	OnCellClicked.ExecuteIfBound(CellIndex, MouseEvent);
+}
+
+void UInv_GridRenderer::HandleHoveredCellChanged(int32 PreviousCellIndex, int32 CellIndex, const FPointerEvent& MouseEvent) const
+{
+	OnHoveredCellChanged.ExecuteIfBound(PreviousCellIndex, CellIndex, MouseEvent);
+}
@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Inventory/Spatial/Inv_GridRetainerBox.h"
+
+UInv_GridRetainerBox::UInv_GridRetainerBox()
+{
+	// 셀과 아이템은 거의 바뀌지 않으므로 무효화될 때만 렌더 타깃을 갱신합니다
+	RenderOnInvalidation = true;
+	RenderOnPhase = false;
+}
@@ -7,255 +7,427 @@
 #include "Blueprint/WidgetLayoutLibrary.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Components/Image.h"
+#include "Components/InvalidationBox.h"
+#include "HAL/PlatformTime.h"
 #include "InventoryManagement/Components/Inv_InventoryComponent.h"
+#include "InventoryManagement/Grid/Inv_GridModel.h"
 #include "InventoryManagement/Utils/Inv_InventoryStatics.h"
 #include "Items/Inv_InventoryItem.h"
 #include "Items/Components/Inv_ItemComponent.h"
 #include "Items/Fragments/Inv_FragmentTags.h"
 #include "Items/Fragments/Inv_ItemFragment.h"
+#include "UnrealClient.h"
 #include "Widgets/Inventory/GridSlots/Inv_GridSlot.h"
 #include "Widgets/Inventory/HoverItem/Inv_HoverItem.h"
+#include "Widgets/Inventory/Spatial/Inv_GridHighlight.h"
+#include "Widgets/Inventory/Spatial/Inv_GridRenderer.h"
+#include "Widgets/Inventory/Spatial/Inv_GridRetainerBox.h"
+#include "Widgets/Utils/Inv_IconStreamingSubsystem.h"
 #include "Widgets/Utils/Inv_WidgetUtils.h"
 #include "Widgets/Inventory/SlottedItems/Inv_SlottedItem.h"
 #include "Widgets/Inventory/HoverItem/Inv_HoverItem.h"
 #include "Widgets/ItemPopUp/Inv_ItemPopUp.h"
+#include "Widgets/Pool/Inv_WidgetPoolSubsystem.h"
 
 void UInv_InventoryGrid::NativeOnInitialized()
 {
 	Super::NativeOnInitialized();
 
-	// 그리드 슬롯들을 생성하고 초기화합니다
-	ConstructGrid();
-
-	// 인벤토리 컴포넌트를 찾아 이벤트를 바인딩합니다
+	// 인벤토리 컴포넌트를 찾습니다 (그리드 크기와 점유 상태는 컴포넌트의 그리드 모델이 관리합니다)
 	InventoryComponent = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
+
+	// 보이는 영역 밖으로 걸친 아이템 위젯은 캔버스 경계에서 잘라냅니다
+	// 그리드 슬롯은 탭이 처음 표시될 때 RequestConstruction으로 생성합니다
+	GridCanvasPanel->SetClipping(EWidgetClipping::ClipToBounds);
+
+	// 셀과 아이템을 담을 캐시 레이어는 비어있는 컨테이너라 미리 만들어 둡니다
+	ConstructLayers();
+
+	// 인벤토리 컴포넌트의 이벤트를 바인딩합니다
 	InventoryComponent->OnItemAdded.AddDynamic(this, &ThisClass::AddItem);
 	InventoryComponent->OnStackChange.AddDynamic(this, &ThisClass::AddStacks);
 	InventoryComponent->OnInventoryMenuToggled.AddDynamic(this, &ThisClass::OnInventoryMenuToggled);
+	InventoryComponent->OnGridRearranged.AddDynamic(this, &ThisClass::OnGridRearranged);
+
+	// 호버 아이템 브러시의 뷰포트 스케일은 뷰포트 크기가 바뀔 때만 다시 가져옵니다
+	ViewportScale = UWidgetLayoutLibrary::GetViewportScale(this);
+	ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &ThisClass::OnViewportResized);
+
+	// 아이콘은 필요할 때 스트리밍되며, 로드되는 동안 자리 표시 브러시를 사용합니다
+	IconBrushCache.SetPlaceholderBrush(IconPlaceholderBrush);
+	IconBrushCache.OnIconLoaded.BindUObject(this, &ThisClass::OnIconLoaded);
 }
 
-void UInv_InventoryGrid::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UInv_InventoryGrid::ConstructLayers()
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
+	// 셀 레이어: 리테이너를 사용하면 셀이 무효화될 때만 렌더 타깃을 갱신합니다
+	// 배치 렌더러는 하이라이트도 셀 상태로 그리므로 리테이너를 사용하지 않습니다
+	const bool bRetainCells = bRetainStaticLayer && !bUseBatchedRenderer;
+	if (bRetainCells)
+	{
+		CellLayer = NewObject<UInv_GridRetainerBox>(this);
+	}
+	else
+	{
+		CellLayer = NewObject<UInvalidationBox>(this);
+	}
+	CellCanvasPanel = NewObject<UCanvasPanel>(this);
+	CellCanvasPanel->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+	CellLayer->SetContent(CellCanvasPanel);
+	AddFullSizeLayer(CellLayer);
 
-	// 캔버스와 마우스 위치를 가져옵니다
-	const FVector2D CanvasPosition = UInv_WidgetUtils::GetWidgetPosition(GridCanvasPanel);
-	const FVector2D MousePosition = UWidgetLayoutLibrary::GetMousePositionOnViewport(GetOwningPlayer());
+	// 하이라이트 레이어: 캐시된 셀 위, 아이템 아래에 하이라이트만 그립니다 (하이라이트가 바뀔 때만 다시 그림)
+	if (bRetainCells)
+	{
+		HighlightLayer = NewObject<UInv_GridHighlight>(this);
+		HighlightLayer->InitializeHighlight(TileSize, GridSlotClass.GetDefaultObject());
+		AddFullSizeLayer(HighlightLayer);
+		HighlightLayer->SetVisibility(ESlateVisibility::HitTestInvisible);
+	}
 
-	// 커서가 캔버스를 벗어났다면 조기 반환합니다
-	if (CursorExitedCanvas(CanvasPosition, UInv_WidgetUtils::GetWidgetSize(GridCanvasPanel), MousePosition))
+	// 아이템 레이어: 슬롯 아이템 위젯은 추가되거나 바뀔 때만 다시 그립니다
+	if (!bUseBatchedRenderer)
 	{
-		return;
+		ItemLayer = NewObject<UInvalidationBox>(this);
+		ItemCanvasPanel = NewObject<UCanvasPanel>(this);
+		ItemCanvasPanel->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+		ItemLayer->SetContent(ItemCanvasPanel);
+		AddFullSizeLayer(ItemLayer);
 	}
+}
+
+void UInv_InventoryGrid::AddFullSizeLayer(UWidget* Layer)
+{
+	UCanvasPanelSlot* LayerCPS = GridCanvasPanel->AddChildToCanvas(Layer);
+	LayerCPS->SetAnchors(FAnchors(0.f, 0.f, 1.f, 1.f));
+	LayerCPS->SetOffsets(FMargin(0.f));
 
-	// 타일 파라미터를 업데이트합니다 (마우스 위치 추적)
-	UpdateTileParameters(CanvasPosition, MousePosition);
+	// 레이어의 빈 영역은 아래 레이어로 마우스 입력을 통과시킵니다
+	Layer->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
 }
 
-FInv_SlotAvailabilityResult UInv_InventoryGrid::HasRoomForItem(const UInv_ItemComponent* ItemComponent)
+void UInv_InventoryGrid::BeginDestroy()
 {
-	// 아이템 컴포넌트의 매니페스트를 사용하여 공간 확인
-	return HasRoomForItem(ItemComponent->GetItemManifest());
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+	Super::BeginDestroy();
 }
 
-FInv_SlotAvailabilityResult UInv_InventoryGrid::HasRoomForItem(const UInv_InventoryItem* Item, const int32 StackAmountOverride)
+void UInv_InventoryGrid::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
-	// 인벤토리 아이템의 매니페스트를 사용하여 공간 확인
-	return HasRoomForItem(Item->GetItemManifest(),StackAmountOverride);
+	CastChecked<ThisClass>(InThis)->IconBrushCache.AddReferencedObjects(Collector);
+	Super::AddReferencedObjects(InThis, Collector);
 }
 
-FInv_SlotAvailabilityResult UInv_InventoryGrid::HasRoomForItem(const FInv_ItemManifest& Manifest, const int32 StackAmountOverride)
+void UInv_InventoryGrid::OnViewportResized(FViewport* Viewport, uint32 Unused)
 {
-	FInv_SlotAvailabilityResult Result;
+	const float NewViewportScale = UWidgetLayoutLibrary::GetViewportScale(this);
+	if (FMath::IsNearlyEqual(NewViewportScale, ViewportScale)) return;
+	ViewportScale = NewViewportScale;
 
-	// 아이템이 스택 가능한지 확인합니다
-	// StackableFragment가 있으면 스택 가능한 아이템입니다
-	const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>();
-	Result.bStackable = StackableFragment != nullptr;
-	
-	// 스택 크기 정보를 초기화합니다
-	// - MaxStackSize: 한 슬롯에 쌓을 수 있는 최대 개수 (예: 64)
-	// - AmountToFill: 그리드에 추가하려는 아이템의 총 개수
-	const int32 MaxStackSize = StackableFragment ? StackableFragment->GetMaxStackSize() : 1;
-	int32 AmountToFill = StackableFragment ? StackableFragment->GetStackCount() : 1;
-	if (StackAmountOverride != -1 && Result.bStackable)
+	// 캐시된 브러시를 참조하던 아이템들을 다시 그리고, 호버 아이템은 새 스케일의 브러시로 바꿉니다
+	IconBrushCache.Reset();
+	if (bGridConstructed)
 	{
-		AmountToFill = StackAmountOverride;
+		RefreshVisibleWindow();
 	}
-	
-	TSet<int32> CheckedIndices;
-	
-	// 모든 그리드 슬롯을 순회하며 아이템을 배치할 수 있는 공간을 찾습니다
-	for (const auto& GridSlot : GridSlots)
+	RefreshHoverItemBrush();
+}
+
+void UInv_InventoryGrid::OnIconLoaded()
+{
+	if (bIconRefreshPending || !IsValid(GetWorld())) return;
+	bIconRefreshPending = true;
+	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::RefreshLoadedIcons);
+}
+
+void UInv_InventoryGrid::RefreshLoadedIcons()
+{
+	bIconRefreshPending = false;
+
+	// 배치 렌더러는 캐시된 브러시를 직접 참조하지만, 슬롯 아이템 위젯은 브러시 복사본을 가지므로 다시 설정합니다
+	if (bGridConstructed)
 	{
-		// 모든 수량이 배치되었다면 검색 종료
-		if (AmountToFill == 0 ) break;
+		RefreshVisibleWindow();
+	}
+	RefreshHoverItemBrush();
+}
 
-		// 이미 이전 반복에서 점유된 것으로 표시된 슬롯은 건너뜁니다
-		if (IsIndexClaimed(CheckedIndices, GridSlot->GetIndex())) continue;
+void UInv_InventoryGrid::RefreshHoverItemBrush()
+{
+	if (!IsValid(HoverItem) || !IsValid(HoverItem->GetInventoryItem())) return;
 
-		// 아이템이 그리드 경계를 벗어나면 건너뜁니다
-		// 예: 2x2 아이템을 마지막 열에 배치하려고 하면 범위 초과
-		if (!IsInGridBounds(GridSlot->GetIndex(), GetItemDimensions(Manifest))) continue;
+	const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(HoverItem->GetInventoryItem(), FragmentTags::GridFragment);
+	const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(HoverItem->GetInventoryItem(), FragmentTags::IconFragment);
+	if (!GridFragment || !ImageFragment) return;
 
-		// 현재 위치에 아이템을 배치할 수 있는지 확인합니다
-		// TentativelyClaimed: 이 위치에 배치할 경우 점유될 슬롯들의 인덱스 집합
-		TSet<int32> TentativelyClaimed;
-		if (!HasRoomAtIndex(GridSlot, GetItemDimensions(Manifest), CheckedIndices, TentativelyClaimed, Manifest.GetItemType(), MaxStackSize))
-		{
-			continue;
-		}
+	HoverItem->SetImageBrush(GetIconBrush(GridFragment, ImageFragment, ViewportScale));
+}
+
+FReply UInv_InventoryGrid::NativeOnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!bGridConstructed) return Super::NativeOnMouseMove(MyGeometry, MouseEvent);
+
+	// 마우스 위치를 캔버스 로컬 좌표로 변환합니다 (캔버스 위치는 원점)
+	const FGeometry& CanvasGeometry = GridCanvasPanel->GetCachedGeometry();
+	LastCanvasMousePosition = CanvasGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
 
-		// 이 슬롯에 실제로 채울 수 있는 수량을 계산합니다
-		// 스택 가능 아이템의 경우: min(AmountToFill, 슬롯의 남은 공간)
-		// 스택 불가능 아이템의 경우: 1
-		const int32 AmountToFillInSlot = DetermineFillAmountForSlot(Result.bStackable, MaxStackSize, AmountToFill, GridSlot);
-		if (AmountToFillInSlot == 0) continue;
-
-		// 임시로 표시한 슬롯들을 실제 점유 목록에 추가합니다
-		CheckedIndices.Append(TentativelyClaimed);
-
-		// 결과에 이 슬롯의 정보를 추가합니다
-		Result.TotalRoomToFill += AmountToFillInSlot;
-		Result.SlotAvailabilities.Emplace(
-			FInv_SlotAvailability{
-				// 이미 아이템이 있는 슬롯이면 해당 아이템의 좌상단 인덱스 사용
-				HasValidItem(GridSlot) ? GridSlot->GetUpperLeftGridIndex() : GridSlot->GetIndex(),
-				// 스택 가능한 경우만 수량 정보 저장
-				Result.bStackable ? AmountToFillInSlot : 0,
-				// 이 위치에 이미 아이템이 있는지 여부
-				HasValidItem(GridSlot)
-			}
-		);
-
-		// 남은 배치할 수량을 감소시킵니다
-		AmountToFill -= AmountToFillInSlot;
-		Result.Remainder = AmountToFill;
-
-		// 모든 수량이 배치되었다면 즉시 반환
-		if (AmountToFill == 0) return Result;
+	// 커서가 캔버스를 벗어나지 않았다면 타일 파라미터를 업데이트합니다
+	if (!CursorExitedCanvas(FVector2D::ZeroVector, CanvasGeometry.GetLocalSize(), LastCanvasMousePosition))
+	{
+		UpdateTileParameters(FVector2D::ZeroVector, LastCanvasMousePosition);
 	}
-	return Result;
+	return Super::NativeOnMouseMove(MyGeometry, MouseEvent);
 }
 
-bool UInv_InventoryGrid::HasRoomAtIndex(const UInv_GridSlot* GridSlot,const FIntPoint& Dimensions,const TSet<int32>& CheckedIndices,TSet<int32>& OutTentativelyClaimed, const FGameplayTag& ItemType, const int32 MaxStackSize)
+void UInv_InventoryGrid::NativeOnMouseLeave(const FPointerEvent& MouseEvent)
 {
-	bool bHasRoomAtIndex = true;
+	Super::NativeOnMouseLeave(MouseEvent);
 
-	// 아이템이 차지할 모든 슬롯을 순회하며 제약 조건을 확인합니다
-	// 예: 2x2 아이템이라면 4개의 슬롯을 모두 확인
-	UInv_InventoryStatics::ForEach2D(GridSlots, GridSlot->GetIndex(), Dimensions, Columns, [&](const UInv_GridSlot* SubGridSlot)
+	// 위젯을 벗어나면 캔버스도 벗어난 것이므로 하이라이트를 해제합니다
+	bLastMouseWithinCanvas = bMouseWithinCanvas;
+	bMouseWithinCanvas = false;
+	if (bLastMouseWithinCanvas)
 	{
-		// 각 슬롯이 아이템을 배치하기 위한 제약 조건을 만족하는지 확인합니다
-		// (비어있거나, 같은 종류의 스택 가능 아이템이 있고 공간이 남아있어야 함)
-		if (CheckSlotConstraints(GridSlot, SubGridSlot, CheckedIndices, OutTentativelyClaimed, ItemType, MaxStackSize))
+		ClearHighlight();
+		bHoverQueryValid = false;
+	}
+}
+
+FReply UInv_InventoryGrid::NativeOnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	// 모든 행이 보이면 스크롤할 필요가 없습니다
+	if (!bGridConstructed || GetNumVisibleRows() >= Rows) return Super::NativeOnMouseWheel(MyGeometry, MouseEvent);
+
+	// 휠을 위로 굴리면 위쪽 행이 보이도록 한 행씩 스크롤합니다
+	ScrollToRow(FirstVisibleRow - FMath::Sign(MouseEvent.GetWheelDelta()));
+	return FReply::Handled();
+}
+
+void UInv_InventoryGrid::ScrollToRow(int32 Row)
+{
+	Row = FMath::Clamp(Row, 0, FMath::Max(Rows - GetNumVisibleRows(), 0));
+	if (Row == FirstVisibleRow) return;
+
+	// 구성 전이면 행만 기억해 두고 구성이 끝날 때 그립니다
+	FirstVisibleRow = Row;
+	if (!bGridConstructed) return;
+	RefreshVisibleWindow();
+}
+
+void UInv_InventoryGrid::RequestConstruction()
+{
+	if (bGridConstructionStarted) return;
+	bGridConstructionStarted = true;
+	ConstructGrid();
+}
+
+int32 UInv_InventoryGrid::GetNumVisibleRows() const
+{
+	return VisibleRows > 0 ? FMath::Min(VisibleRows, Rows) : Rows;
+}
+
+bool UInv_InventoryGrid::IsValidGridIndex(const int32 Index) const
+{
+	return Index >= 0 && Index < Rows * Columns;
+}
+
+UInv_GridSlot* UInv_InventoryGrid::GetGridSlot(const int32 Index) const
+{
+	if (!IsValidGridIndex(Index)) return nullptr;
+
+	// 그리드 인덱스를 보이는 영역 기준의 인덱스로 변환합니다
+	const int32 WindowIndex = Index - FirstVisibleRow * Columns;
+	return GridSlots.IsValidIndex(WindowIndex) ? GridSlots[WindowIndex].Get() : nullptr;
+}
+
+void UInv_InventoryGrid::ForEachVisibleCell(const int32 Index, const FIntPoint& Dimensions, const TFunctionRef<void(int32)> Function) const
+{
+	// 영역을 그리드의 열 범위와 보이는 행 범위로 잘라냅니다
+	const FIntPoint Position = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns);
+	const int32 FirstColumn = FMath::Max(Position.X, 0);
+	const int32 LastColumn = FMath::Min(Position.X + Dimensions.X, Columns);
+	const int32 FirstRow = FMath::Max(Position.Y, FirstVisibleRow);
+	const int32 LastRow = FMath::Min(Position.Y + Dimensions.Y, FirstVisibleRow + GetNumVisibleRows());
+
+	for (int32 Row = FirstRow; Row < LastRow; ++Row)
+	{
+		for (int32 Column = FirstColumn; Column < LastColumn; ++Column)
 		{
-			OutTentativelyClaimed.Add(SubGridSlot->GetIndex());
+			Function(Column + Row * Columns);
 		}
-		else
+	}
+}
+
+void UInv_InventoryGrid::SetCellState(const int32 Index, const EInv_GridSlotState State)
+{
+	// 하이라이트 밖의 경로가 하이라이트 영역의 셀을 바꾸면 다음 하이라이트 갱신에서 겹치는 셀도 다시 칠합니다
+	if (bLastHighlightIntact)
+	{
+		const FIntPoint Position = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns);
+		const FIntPoint LastPosition = UInv_WidgetUtils::GetPositionFromIndex(LastHighlightedIndex, Columns);
+		if (FIntRect(LastPosition, LastPosition + LastHighlightedDimensions).Contains(Position))
 		{
-			// 하나의 슬롯이라도 제약 조건을 만족하지 못하면 전체 배치 불가능
-			bHasRoomAtIndex = false;
+			bLastHighlightIntact = false;
 		}
-	});
+	}
 
-	return bHasRoomAtIndex;
+	// 배치 렌더러를 사용하면 렌더러의 셀 상태를, 아니면 슬롯 위젯의 텍스처를 바꿉니다
+	if (IsValid(GridRenderer))
+	{
+		GridRenderer->SetCellState(Index - FirstVisibleRow * Columns, State);
+		return;
+	}
+	if (UInv_GridSlot* GridSlot = GetGridSlot(Index))
+	{
+		GridSlot->SetGridSlotState(State);
+	}
 }
 
-bool UInv_InventoryGrid::CheckSlotConstraints(const UInv_GridSlot* GridSlot, const UInv_GridSlot* SubGridSlot,const TSet<int32>& CheckedIndices, TSet<int32>& OutTentativelyClaimed, const FGameplayTag& ItemType, const int32 MaxStackSize) const
+bool UInv_InventoryGrid::IsAreaVisible(const int32 Index, const FIntPoint& Dimensions) const
 {
-	// 이미 다른 아이템 배치를 위해 예약된 슬롯이면 사용 불가
-	if (IsIndexClaimed(CheckedIndices, SubGridSlot->GetIndex())) return false;
+	const int32 Row = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns).Y;
+	return Row < FirstVisibleRow + GetNumVisibleRows() && Row + Dimensions.Y > FirstVisibleRow;
+}
 
-	// 슬롯이 비어있으면 배치 가능
-	if (!HasValidItem(SubGridSlot))
+void UInv_InventoryGrid::RefreshVisibleWindow()
+{
+	// 하이라이트는 보이는 영역 기준이므로 지우고, 보이는 셀들이 새 행을 표시하도록 슬롯 위젯의 인덱스와 점유 표시를 갱신합니다
+	ClearHighlight();
+	const FInv_GridModel& GridModel = GetGridModel();
+	for (int32 WindowIndex = 0; WindowIndex < GetNumVisibleRows() * Columns; ++WindowIndex)
 	{
-		OutTentativelyClaimed.Add(SubGridSlot->GetIndex());
-		return true;
+		const int32 Index = WindowIndex + FirstVisibleRow * Columns;
+		if (GridSlots.IsValidIndex(WindowIndex))
+		{
+			GridSlots[WindowIndex]->SetTileIndex(Index);
+		}
+		SetCellState(Index, GridModel.IsOccupied(Index) ? EInv_GridSlotState::Occupied : EInv_GridSlotState::Unoccupied);
 	}
 
-	// 슬롯에 이미 아이템이 있는 경우, 스택 가능 여부를 확인합니다
-	// SubGridSlot이 GridSlot의 좌상단 슬롯이 아니면 (다른 아이템의 일부라면) 배치 불가
-	if (!IsUpperLeftSlot(GridSlot, SubGridSlot)) return false;
+	// 하이라이트는 위에서 지워졌으므로 호버 위치를 다시 검사합니다 (아이템 배치 후)
+	bHoverQueryValid = false;
 
-	// 기존 아이템이 스택 가능한지 확인
-	const UInv_InventoryItem* SubItem = SubGridSlot->GetInventoryItem().Get();
-	if (!SubItem->IsStackable()) return false;
-
-	// 기존 아이템과 추가하려는 아이템의 타입이 일치하는지 확인
-	if (!DoesItemTypeMatch(SubItem, ItemType)) return false;
-
-	// 기존 스택이 최대 용량에 도달했는지 확인
-	if (GridSlot->GetStackCount() >= MaxStackSize) return false;
+	// 아이템 위젯을 모두 회수하고 보이는 영역과 겹치는 배치만 다시 배치합니다
+	// 다시 배치되지 않은 아이콘의 브러시는 버려 화면에 없는 아이콘이 메모리에서 내려갈 수 있게 합니다
+	IconBrushCache.ResetUsage();
+	for (const auto& [Index, SlottedItem] : SlottedItems)
+	{
+		ReleaseSlottedItem(SlottedItem);
+	}
+	SlottedItems.Reset();
+	if (IsValid(GridRenderer))
+	{
+		GridRenderer->ClearItems();
+	}
 
-	// 모든 조건을 만족하면 스택에 추가 가능
-	return true ;
+	for (const auto& [Index, Placement] : GridModel.GetPlacements())
+	{
+		AddItemAtIndex(Placement.Item.Get(), Index, Placement.bStackable, Placement.StackCount);
+	}
+	RefreshHoverItemBrush();
+	IconBrushCache.RemoveUnused();
+	RefreshHoverQuery();
 }
 
-bool UInv_InventoryGrid::HasValidItem(const UInv_GridSlot* GridSlot) const
+UInv_SlottedItem* UInv_InventoryGrid::AcquireSlottedItem()
 {
-	// 슬롯에 유효한 아이템이 있는지 확인
-	return GridSlot->GetInventoryItem().IsValid();
+	// 풀의 위젯은 다른 그리드가 쓰던 것일 수 있으므로 꺼낼 때마다 클릭 이벤트를 바인딩합니다 (반환 시 해제됨)
+	UInv_SlottedItem* SlottedItem = UInv_WidgetPoolSubsystem::AcquireWidget<UInv_SlottedItem>(GetOwningPlayer(), SlottedItemClass);
+	SlottedItem->OnSlottedItemClicked.AddDynamic(this, &UInv_InventoryGrid::OnSlottedItemClicked);
+	/* 아래 함수들을 이용하면 마우스가 다운 및 업중일때 이벤트를 호출할 수 있음
+	 * SlottedItem->OnMouseButtonDown
+	 * SlottedItem->OnMouseButtonUp */
+	return SlottedItem;
 }
 
-bool UInv_InventoryGrid::IsUpperLeftSlot(const UInv_GridSlot* GridSlot, const UInv_GridSlot* SubGridSlot) const
+void UInv_InventoryGrid::ReleaseSlottedItem(UInv_SlottedItem* SlottedItem)
 {
-	// SubGridSlot의 좌상단 인덱스가 GridSlot의 인덱스와 같은지 확인
-	return SubGridSlot->GetUpperLeftGridIndex() == GridSlot->GetIndex();
+	// 풀에 반환하면 아이템 참조와 클릭 바인딩이 초기화됩니다
+	UInv_WidgetPoolSubsystem::ReleaseWidget(SlottedItem);
 }
 
-bool UInv_InventoryGrid::DoesItemTypeMatch(const UInv_InventoryItem* SubItem, const FGameplayTag& ItemType) const
+void UInv_InventoryGrid::UpdateSlottedItemStackCount(const int32 Index, const int32 StackCount)
 {
-	// 아이템 타입 GameplayTag가 정확히 일치하는지 확인
-	return SubItem->GetItemManifest().GetItemType().MatchesTagExact(ItemType);
+	// 보이는 영역 밖의 아이템은 위젯이 없으며, 스크롤될 때 모델의 수량으로 만들어집니다
+	if (UInv_SlottedItem* SlottedItem = SlottedItems.FindRef(Index))
+	{
+		SlottedItem->UpdateStackCount(StackCount);
+	}
+	if (IsValid(GridRenderer))
+	{
+		GridRenderer->SetItemStackCount(Index, StackCount);
+	}
 }
 
-bool UInv_InventoryGrid::IsInGridBounds(const int32 StartIndex, const FIntPoint& ItemDimensions) const
+void UInv_InventoryGrid::OnRendererCellClicked(int32 CellIndex, const FPointerEvent& MouseEvent)
 {
-	// 시작 인덱스가 유효한 범위 내에 있는지 확인
-	if (StartIndex < 0 || StartIndex >= GridSlots.Num()) return false;
-
-	// 아이템의 끝 위치가 그리드 경계를 넘지 않는지 확인
-	const int32 EndColumn = (StartIndex % Columns) + ItemDimensions.X;
-	const int32 EndRow = (StartIndex / Columns) + ItemDimensions.Y;
-	return EndColumn <= Columns && EndRow <= Rows;
+	// 아이템이 있는 셀이면 슬롯 아이템 위젯을, 없으면 그리드 슬롯 위젯을 클릭한 것과 같게 처리합니다
+	const int32 Index = CellIndex + FirstVisibleRow * Columns;
+	const int32 UpperLeftIndex = GetGridModel().GetUpperLeftIndex(Index);
+	if (UpperLeftIndex != INDEX_NONE)
+	{
+		OnSlottedItemClicked(UpperLeftIndex, MouseEvent);
+		return;
+	}
+	OnGridSlotClicked(Index, MouseEvent);
 }
 
-int32 UInv_InventoryGrid::DetermineFillAmountForSlot(const bool bStackable, const int32 MaxStackSize, const int32 AmountToFill, const UInv_GridSlot* GridSlot) const
+void UInv_InventoryGrid::OnRendererHoveredCellChanged(int32 PreviousCellIndex, int32 CellIndex, const FPointerEvent& MouseEvent)
 {
-	// 슬롯에 채울 수 있는 여유 공간 계산
-	const int32 RoomInSlot = MaxStackSize - GetStackAmount(GridSlot);
-	// 스택 가능하면 최소값 사용, 아니면 1개만
-	return bStackable ? FMath::Min(AmountToFill, RoomInSlot) : 1;
-}
+	const FInv_GridModel& GridModel = GetGridModel();
+	const int32 PreviousIndex = PreviousCellIndex != INDEX_NONE ? PreviousCellIndex + FirstVisibleRow * Columns : INDEX_NONE;
+	const int32 Index = CellIndex != INDEX_NONE ? CellIndex + FirstVisibleRow * Columns : INDEX_NONE;
 
-int32 UInv_InventoryGrid::GetStackAmount(const UInv_GridSlot* GridSlot) const
-{
-	int32 CurrentSlotStackCount = GridSlot->GetStackCount();
-	// 여러 슬롯을 차지하는 아이템의 경우, 스택 수는 항상 좌상단 슬롯에 저장되므로 해당 슬롯에서 값을 가져옵니다
-	if (const int32 UpperLeftIndex = GridSlot->GetUpperLeftGridIndex(); UpperLeftIndex != INDEX_NONE)
+	// 슬롯 위젯의 마우스 진입/이탈과 같게 처리합니다
+	if (PreviousIndex != INDEX_NONE) OnGridSlotUnhovered(PreviousIndex, MouseEvent);
+	if (Index != INDEX_NONE) OnGridSlotHovered(Index, MouseEvent);
+
+	// 다른 아이템으로 넘어갔을 때만 슬롯 아이템 위젯처럼 아이템 설명을 갱신합니다
+	const int32 PreviousUpperLeftIndex = GridModel.GetUpperLeftIndex(PreviousIndex);
+	const int32 UpperLeftIndex = GridModel.GetUpperLeftIndex(Index);
+	if (PreviousUpperLeftIndex == UpperLeftIndex) return;
+
+	if (PreviousUpperLeftIndex != INDEX_NONE)
+	{
+		UInv_InventoryStatics::ItemUnhovered(GetOwningPlayer());
+	}
+	if (UpperLeftIndex != INDEX_NONE)
 	{
-		UInv_GridSlot* UpperLeftGridSlot = GridSlots[UpperLeftIndex];
-		CurrentSlotStackCount = UpperLeftGridSlot->GetStackCount();
+		UInv_InventoryStatics::ItemHovered(GetOwningPlayer(), GridModel.GetItem(UpperLeftIndex));
 	}
-	return CurrentSlotStackCount;
 }
 
-FIntPoint UInv_InventoryGrid::GetItemDimensions(const FInv_ItemManifest& Manifest) const
+FInv_SlotAvailabilityResult UInv_InventoryGrid::HasRoomForItem(const UInv_ItemComponent* ItemComponent)
+{
+	// 배치 검사는 위젯이 아닌 그리드 모델에서 수행합니다
+	return GetGridModel().HasRoomForItem(ItemComponent->GetItemManifest());
+}
+
+const FInv_GridModel& UInv_InventoryGrid::GetGridModel() const
 {
-	// 그리드 프래그먼트에서 아이템 크기를 가져옵니다 (없으면 기본 1x1)
-	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
-	return GridFragment ? GridFragment->GetGridSize() : FIntPoint(1, 1);
+	check(InventoryComponent.IsValid());
+	return InventoryComponent->GetGridModel(ItemCategory);
 }
 
 void UInv_InventoryGrid::AddItem(UInv_InventoryItem* Item)
 {
-	// 카테고리가 일치하지 않으면 무시
 	if (!MatchesCategory(Item)) return;
 
-	// 공간이 있는지 확인하고 결과에 따라 아이템 추가
-	FInv_SlotAvailabilityResult Result = HasRoomForItem(Item);
-	AddItemToIndices(Result, Item);
+	// 그리드가 보이기 전에 아이콘 스트리밍을 시작합니다 (보이는 영역 밖이나 구성 전이어도)
+	UInv_IconStreamingSubsystem::PrefetchItemIcon(GetOwningPlayer(), Item->GetItemManifest());
+
+	// 아직 구성되지 않은 그리드라면 무시 (구성이 끝날 때 모델에서 만들어짐)
+	if (!bGridConstructed) return;
+
+	// 아이템은 이미 그리드 모델에 배치되어 있으므로, 모델의 배치 정보대로 위젯을 생성합니다
+	for (const auto& [Index, Placement] : GetGridModel().GetPlacements())
+	{
+		if (Placement.Item != Item || SlottedItems.Contains(Index)) continue;
+
+		AddItemAtIndex(Item, Index, Placement.bStackable, Placement.StackCount);
+		UpdateGridSlots(Index, Placement.Dimensions);
+	}
 }
 
 void UInv_InventoryGrid::ShowCursor()
@@ -280,75 +452,53 @@ void UInv_InventoryGrid::SetOwningCanvas(UCanvasPanel* OwningCanvas)
 	OwningCanvasPanel = OwningCanvas;
 }
 
-void UInv_InventoryGrid::AddItemToIndices(const FInv_SlotAvailabilityResult& Result, UInv_InventoryItem* NewItem)
-{
-	// 사용 가능한 모든 슬롯에 아이템을 추가하고 업데이트합니다
-	for (const auto& Availability : Result.SlotAvailabilities)
-	{
-		AddItemAtIndex(NewItem, Availability.Index, Result.bStackable, Availability.AmountToFill);
-		UpdateGridSlots(NewItem, Availability.Index, Result.bStackable, Availability.AmountToFill);
-	}
-}
-
 UInv_SlottedItem* UInv_InventoryGrid::CreateSlottedItem(UInv_InventoryItem* Item, const bool bStackable, const int32 StackAmount, const FInv_GridFragment* GridFragment, const FInv_ImageFragment* ImageFragment, const int32 Index)
 {
-	// 슬롯 아이템 위젯을 생성하고 초기화합니다
-	UInv_SlottedItem* SlottedItem = CreateWidget<UInv_SlottedItem>(GetOwningPlayer(), SlottedItemClass);
+	// 슬롯 아이템 위젯을 가져와 초기화합니다 (재사용 위젯이 있으면 재사용)
+	UInv_SlottedItem* SlottedItem = AcquireSlottedItem();
 	SlottedItem->SetInventoryItem(Item);
 	SetSlottedItemImage(SlottedItem, GridFragment, ImageFragment);
 	SlottedItem->SetGridIndex(Index);
 	SlottedItem->SetIsStackable(bStackable);
 	const int32 StackUpdateAmount = bStackable ? StackAmount : 0;
 	SlottedItem->UpdateStackCount(StackUpdateAmount);
-
-	// 클릭 이벤트를 바인딩합니다
-	SlottedItem->OnSlottedItemClicked.AddDynamic(this, &UInv_InventoryGrid::OnSlottedItemClicked);
-	/* 아래 함수들을 이용하면 마우스가 다운 및 업중일때 이벤트를 호출할 수 있음
-	 * SlottedItem->OnMouseButtonDown
-	 * SlottedItem->OnMouseButtonUp */
 	return SlottedItem;
 }
 
-void UInv_InventoryGrid::AddSlottedItemToCanvas(const int32 Index, const FInv_GridFragment* GridFragment, UInv_SlottedItem* SlottedItem)
+void UInv_InventoryGrid::AddSlottedItemToCanvas(const int32 Index, const FInv_GridFragment* GridFragment, UInv_SlottedItem* SlottedItem, const bool bRotated)
 {
-	// 슬롯 아이템을 캔버스에 추가하고 위치와 크기를 설정합니다
-	GridCanvasPanel->AddChild(SlottedItem);
+	// 슬롯 아이템을 아이템 레이어에 추가하고 위치와 크기를 설정합니다
+	ItemCanvasPanel->AddChild(SlottedItem);
 	UCanvasPanelSlot* CanvasSlot = UWidgetLayoutLibrary::SlotAsCanvasSlot(SlottedItem);
-	CanvasSlot->SetSize(GetDrawSize(GridFragment));
+	CanvasSlot->SetSize(GetDrawSize(GridFragment, bRotated));
+
+	// 회전해 배치된 아이템은 아이콘을 중심 기준으로 회전합니다 (브러시 크기는 원래 방향 유지)
+	SlottedItem->GetImage_Icon()->SetRenderTransformAngle(bRotated ? 90.f : 0.f);
 
-	// 그리드 인덱스로부터 위치를 계산하고 패딩을 적용합니다
-	const FVector2D DrawPos = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns) * TileSize;
-	const FVector2D DrawposWithPadding = DrawPos + FVector2D(GridFragment->GetGridPadding());
-	CanvasSlot->SetPosition(DrawposWithPadding);
+	// 보이는 영역 기준의 위치에 배치합니다
+	CanvasSlot->SetPosition(GetItemDrawPosition(Index, GridFragment));
 }
 
-void UInv_InventoryGrid::UpdateGridSlots(UInv_InventoryItem* NewItem, const int32 Index, bool bStackableItem, const int32 StackAmount)
+FVector2D UInv_InventoryGrid::GetItemDrawPosition(const int32 Index, const FInv_GridFragment* GridFragment) const
 {
-	check(GridSlots.IsValidIndex(Index));
-
-	// 스택 가능 아이템이면 스택 수량 설정
-	if (bStackableItem)
-	{
-		GridSlots[Index]->SetStackCount(StackAmount);
-	}
+	// 보이는 영역 기준의 타일 위치를 계산하고 패딩을 적용합니다
+	const FIntPoint TilePosition = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns) - FIntPoint(0, FirstVisibleRow);
+	const FVector2D DrawPos = TilePosition * TileSize;
+	return DrawPos + FVector2D(GridFragment->GetGridPadding());
+}
 
-	// 아이템이 차지하는 모든 슬롯을 업데이트합니다
-	const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(NewItem, FragmentTags::GridFragment);
-	const FIntPoint Dimensions = GridFragment ? GridFragment->GetGridSize() : FIntPoint(1, 1);
+void UInv_InventoryGrid::UpdateGridSlots(const int32 Index, const FIntPoint& Dimensions)
+{
+	check(IsValidGridIndex(Index));
 
-	UInv_InventoryStatics::ForEach2D(GridSlots, Index, Dimensions, Columns, [&](UInv_GridSlot* GridSlot)
+	// 아이템이 차지하는 슬롯 중 보이는 슬롯을 점유 상태로 표시합니다
+	ForEachVisibleCell(Index, Dimensions, [this](const int32 CellIndex)
 	{
-		GridSlot->SetInventoryItem(NewItem);
-		GridSlot->SetUpperLeftGridIndex(Index);
-		GridSlot->SetOccupiedTexture();
-		GridSlot->SetAvailable(false);
+		SetCellState(CellIndex, EInv_GridSlotState::Occupied);
 	});
-}
 
-bool UInv_InventoryGrid::IsIndexClaimed(const TSet<int32>& CheckedIndices, const int32 Index) const
-{
-	// 인덱스가 이미 점유되었는지 확인
-	return CheckedIndices.Contains(Index);
+	// 그리드 내용이 바뀌었으므로 호버 아이템의 하이라이트를 다시 계산합니다
+	RefreshHoverQuery();
 }
 
 void UInv_InventoryGrid::AddItemAtIndex(UInv_InventoryItem* Item, const int32 Index, const bool bStackable, const int32 StackAmount)
@@ -358,33 +508,50 @@ void UInv_InventoryGrid::AddItemAtIndex(UInv_InventoryItem* Item, const int32 In
     const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(Item, FragmentTags::IconFragment);
     if (!GridFragment || !ImageFragment) return;
 
+	// 보이는 영역 밖의 아이템은 위젯을 만들지 않습니다
+	const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(Index);
+	if (Placement && !IsAreaVisible(Index, Placement->Dimensions)) return;
+	const bool bRotated = Placement && Placement->bRotated;
+
+	// 배치 렌더러를 사용하면 위젯 대신 렌더러에 그릴 아이템 정보를 넘깁니다
+	if (IsValid(GridRenderer))
+	{
+		FInv_GridRenderItem RenderItem;
+		RenderItem.Brush = &GetIconBrush(GridFragment, ImageFragment);
+		RenderItem.Position = GetItemDrawPosition(Index, GridFragment);
+		RenderItem.Size = GetDrawSize(GridFragment, bRotated);
+		RenderItem.bRotated = bRotated;
+		RenderItem.StackCount = bStackable ? StackAmount : 0;
+		GridRenderer->AddItem(Index, RenderItem);
+		return;
+	}
+
 	// 슬롯 아이템 위젯을 생성하고 캔버스에 추가합니다
     UInv_SlottedItem* SlottedItem = CreateSlottedItem(Item, bStackable, StackAmount, GridFragment, ImageFragment, Index);
-	AddSlottedItemToCanvas(Index, GridFragment, SlottedItem);
+	AddSlottedItemToCanvas(Index, GridFragment, SlottedItem, bRotated);
 
 	SlottedItems.Add(Index, SlottedItem);
 }
 
 void UInv_InventoryGrid::AddStacks(const FInv_SlotAvailabilityResult& Result)
 {
-	// 카테고리가 일치하지 않으면 무시
-	if (!MatchesCategory(Result.Item.Get())) return;
+	// 카테고리가 일치하지 않거나 아직 구성되지 않은 그리드라면 무시 (구성이 끝날 때 모델에서 만들어짐)
+	if (!bGridConstructed || !MatchesCategory(Result.Item.Get())) return;
 
-	// 각 사용 가능한 슬롯에 스택을 추가합니다
+	// 결과는 이미 그리드 모델에 적용되어 있으므로 모델의 스택 수량을 표시합니다
+	const FInv_GridModel& GridModel = GetGridModel();
 	for (const auto& Availability : Result.SlotAvailabilities)
 	{
 		if (Availability.bItemAtIndex)
 		{
 			// 이미 아이템이 있는 슬롯이면 스택 수량만 업데이트
-			const auto& GridSlot = GridSlots[Availability.Index];
-			const auto& SlottedItem = SlottedItems.FindChecked(Availability.Index);
-			SlottedItem->UpdateStackCount(GridSlot->GetStackCount() + Availability.AmountToFill);
+			UpdateSlottedItemStackCount(Availability.Index, GridModel.GetStackCount(Availability.Index));
 		}
-		else
+		else if (const FInv_GridPlacement* Placement = GridModel.FindPlacement(Availability.Index))
 		{
-			// 비어있는 슬롯이면 새로 아이템 추가
-			AddItemAtIndex(Result.Item.Get(), Availability.Index, Result.bStackable, Availability.AmountToFill);
-			UpdateGridSlots(Result.Item.Get(), Availability.Index, Result.bStackable, Availability.AmountToFill);
+			// 비어있던 슬롯이면 새로 아이템 위젯 추가
+			AddItemAtIndex(Result.Item.Get(), Availability.Index, Result.bStackable, Placement->StackCount);
+			UpdateGridSlots(Availability.Index, Placement->Dimensions);
 		}
 	}
 }
@@ -393,8 +560,8 @@ void UInv_InventoryGrid::OnSlottedItemClicked(int32 GridIndex, const FPointerEve
 {
 	UInv_InventoryStatics::ItemUnhovered(GetOwningPlayer());
 	
-	check(GridSlots.IsValidIndex(GridIndex));
-	UInv_InventoryItem* ClickedInventoryItem = GridSlots[GridIndex]->GetInventoryItem().Get();
+	check(IsValidGridIndex(GridIndex));
+	UInv_InventoryItem* ClickedInventoryItem = GetGridModel().GetItem(GridIndex);
 
 	// 호버 아이템이 없고 왼쪽 클릭이면 아이템을 집어듭니다
 	if (!IsValid(HoverItem) && IsLeftClick(MouseEvent))
@@ -412,7 +579,7 @@ void UInv_InventoryGrid::OnSlottedItemClicked(int32 GridIndex, const FPointerEve
 	// 클릭한 아이템과 호버 아이템이 같은 종류의 스택 가능 아이템인 경우
 	if (IsSameStackable(ClickedInventoryItem))
 	{
-		const int32 ClickedStackCount = GridSlots[GridIndex]->GetStackCount();
+		const int32 ClickedStackCount = GetGridModel().GetStackCount(GridIndex);
 		const FInv_StackableFragment* StackableFragment = ClickedInventoryItem->GetItemManifest().GetFragmentOfType<FInv_StackableFragment>();
 		const int32 MaxStackSize = StackableFragment->GetMaxStackSize();
 		const int32 RoomInClickedSlot = MaxStackSize - ClickedStackCount;
@@ -455,20 +622,19 @@ void UInv_InventoryGrid::OnGridSlotClicked(int32 GridIndex, const FPointerEvent&
 {
 	// 호버 아이템이 없거나 인덱스가 유효하지 않으면 무시
 	if (!IsValid(HoverItem)) return;
-	if (!GridSlots.IsValidIndex(ItemDropIndex)) return;
+	if (!IsValidGridIndex(ItemDropIndex)) return;
 
 	// 클릭한 위치에 아이템이 있으면 해당 아이템을 클릭한 것으로 처리
-	if (CurrentQueryResult.ValidItem.IsValid() && GridSlots.IsValidIndex(CurrentQueryResult.UpperLeftIndex))
+	if (CurrentQueryResult.ValidItem.IsValid() && IsValidGridIndex(CurrentQueryResult.UpperLeftIndex))
 	{
 		OnSlottedItemClicked(CurrentQueryResult.UpperLeftIndex, MouseEvent);
 		return;
 	}
 	
-	if (!IsInGridBounds(ItemDropIndex,HoverItem->GetGridDimensions())) return;
+	if (!GetGridModel().IsInGridBounds(ItemDropIndex,HoverItem->GetGridDimensions())) return;
 	
-	// 빈 슬롯이면 아이템을 놓습니다
-	auto GridSlot = GridSlots[ItemDropIndex];
-	if (!GridSlot->GetInventoryItem().IsValid())
+	// 호버 아이템이 차지할 모든 슬롯이 비어있을 때만 아이템을 놓습니다
+	if (CurrentQueryResult.bHasSpace)
 	{
 		PutDownOnIndex(ItemDropIndex);
 	}
@@ -480,10 +646,9 @@ void UInv_InventoryGrid::OnGridSlotHovered(int32 GridIndex, const FPointerEvent&
 	if (IsValid(HoverItem)) return;
 
 	// 빈 슬롯에 마우스가 올라가면 하이라이트 처리
-	UInv_GridSlot* GridSlot = GridSlots[GridIndex];
-	if (GridSlot->IsAvailable())
+	if (!GetGridModel().IsOccupied(GridIndex))
 	{
-		GridSlot->SetOccupiedTexture();
+		SetCellState(GridIndex, EInv_GridSlotState::Occupied);
 	}
 }
 
@@ -493,32 +658,30 @@ void UInv_InventoryGrid::OnGridSlotUnhovered(int32 GridIndex, const FPointerEven
 	if (IsValid(HoverItem)) return;
 
 	// 슬롯에서 마우스가 벗어나면 하이라이트 해제
-	UInv_GridSlot* GridSlot = GridSlots[GridIndex];
-	if (GridSlot->IsAvailable())
+	if (!GetGridModel().IsOccupied(GridIndex))
 	{
-		GridSlot->SetUnoccupiedTexture();
+		SetCellState(GridIndex, EInv_GridSlotState::Unoccupied);
 	}
 }
 
 void UInv_InventoryGrid::OnPopUpMenuSplit(int32 SplitAmount, int32 Index)
 {
 	// 우클릭한 아이템을 가져옵니다
-	UInv_InventoryItem* RightClickedItem = GridSlots[Index]->GetInventoryItem().Get();
+	UInv_InventoryItem* RightClickedItem = GetGridModel().GetItem(Index);
 	if (!IsValid(RightClickedItem)) return;
 	// 스택 가능한 아이템만 분할할 수 있습니다
 	if (!RightClickedItem->IsStackable()) return;
 
 	// 아이템의 좌상단 인덱스를 찾습니다 (여러 슬롯을 차지하는 아이템의 경우)
-	const int32 UpperLeftIndex = GridSlots[Index]->GetUpperLeftGridIndex();
-	UInv_GridSlot* UpperLeftGridSlot = GridSlots[UpperLeftIndex];
-	const int32 StackCount = UpperLeftGridSlot->GetStackCount();
+	const int32 UpperLeftIndex = GetGridModel().GetUpperLeftIndex(Index);
+	const int32 StackCount = GetGridModel().GetStackCount(UpperLeftIndex);
 
 	// 분할 후 남을 스택 수량을 계산합니다
 	const int32 NewStackCount = StackCount - SplitAmount;
 
-	// 그리드 슬롯과 슬롯 아이템 위젯의 스택 수량을 업데이트합니다
-	UpperLeftGridSlot->SetStackCount(NewStackCount);
-	SlottedItems.FindChecked(UpperLeftIndex)->UpdateStackCount(NewStackCount);
+	// 그리드 모델과 슬롯 아이템 위젯의 스택 수량을 업데이트합니다
+	InventoryComponent->SetGridStackCount(RightClickedItem, UpperLeftIndex, NewStackCount);
+	UpdateSlottedItemStackCount(UpperLeftIndex, NewStackCount);
 
 	// 분할된 아이템을 호버 아이템으로 만듭니다
 	AssignHoverItem(RightClickedItem, UpperLeftIndex, UpperLeftIndex);
@@ -528,7 +691,7 @@ void UInv_InventoryGrid::OnPopUpMenuSplit(int32 SplitAmount, int32 Index)
 void UInv_InventoryGrid::OnPopUpMenuDrop(int32 Index)
 {
 	// 우클릭한 아이템을 가져옵니다
-	UInv_InventoryItem* RightClickedItem = GridSlots[Index]->GetInventoryItem().Get();
+	UInv_InventoryItem* RightClickedItem = GetGridModel().GetItem(Index);
 	if (!IsValid(RightClickedItem)) return;
 
 	// 아이템을 픽업하여 호버 아이템으로 만들고 드롭 처리를 수행합니다
@@ -539,18 +702,17 @@ void UInv_InventoryGrid::OnPopUpMenuDrop(int32 Index)
 void UInv_InventoryGrid::OnPopUpMenuConsume(int32 Index)
 {
 	// 우클릭한 그리드 슬롯의 아이템을 가져옵니다
-	UInv_InventoryItem* RightClickedItem = GridSlots[Index]->GetInventoryItem().Get();
+	UInv_InventoryItem* RightClickedItem = GetGridModel().GetItem(Index);
 	if (!IsValid(RightClickedItem)) return;
 
-	// 아이템의 왼쪽 상단 인덱스를 찾아서 해당 슬롯을 가져옵니다
-	// (아이템이 여러 칸을 차지할 수 있으므로 항상 왼쪽 상단 슬롯에서 스택 수를 관리합니다)
-	const int32 UpperLeftIndex = GridSlots[Index]->GetUpperLeftGridIndex();
-	UInv_GridSlot* UpperLeftGridSlot = GridSlots[UpperLeftIndex];
-	const int32 NewStackCount = UpperLeftGridSlot->GetStackCount() - 1;
+	// 아이템의 왼쪽 상단 인덱스를 찾습니다
+	// (아이템이 여러 칸을 차지할 수 있으므로 그리드 모델은 왼쪽 상단 셀 기준으로 스택 수를 관리합니다)
+	const int32 UpperLeftIndex = GetGridModel().GetUpperLeftIndex(Index);
+	const int32 NewStackCount = GetGridModel().GetStackCount(UpperLeftIndex) - 1;
 
-	// UI에서 스택 수를 업데이트합니다
-	UpperLeftGridSlot->SetStackCount(NewStackCount);
-	SlottedItems.FindChecked(UpperLeftIndex)->UpdateStackCount(NewStackCount);
+	// 그리드 모델과 UI에서 스택 수를 업데이트합니다
+	InventoryComponent->SetGridStackCount(RightClickedItem, UpperLeftIndex, NewStackCount);
+	UpdateSlottedItemStackCount(UpperLeftIndex, NewStackCount);
 
 	// 서버에 아이템 소비를 요청합니다 (실제 인벤토리 데이터 업데이트 및 소비 효과 실행)
 	InventoryComponent->Server_ConsumeItem(RightClickedItem);
@@ -610,9 +772,16 @@ void UInv_InventoryGrid::AssignHoverItem(UInv_InventoryItem* InventoryItem, cons
 	// 호버 아이템을 할당합니다
 	AssignHoverItem(InventoryItem);
 
+	// 그리드에 배치된 방향을 그대로 유지합니다
+	const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(GridIndex);
+	HoverItem->SetRotated(Placement && Placement->bRotated);
+
 	// 이전 위치와 스택 수량을 설정합니다
 	HoverItem->SetPreviousGridIndex(PreviousGridIndex);
-	HoverItem->UpdateStackCount(InventoryItem->IsStackable() ? GridSlots[GridIndex]->GetStackCount() : 0);
+	HoverItem->UpdateStackCount(InventoryItem->IsStackable() ? GetGridModel().GetStackCount(GridIndex) : 0);
+
+	// 마우스가 움직이지 않아도 새 호버 아이템의 배치 가능 위치를 표시합니다
+	RefreshHoverQuery();
 }
 
 void UInv_InventoryGrid::OnHide()
@@ -622,27 +791,34 @@ void UInv_InventoryGrid::OnHide()
 
 void UInv_InventoryGrid::RemoveItemFromGrid(UInv_InventoryItem* InventoryItem, const int32 GridIndex)
 {
-	// 아이템의 그리드 프래그먼트를 가져옵니다
-	const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(InventoryItem, FragmentTags::GridFragment);
-	if (!GridFragment) return;
+	// 그리드 모델에서 아이템의 배치 정보를 가져옵니다
+	const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(GridIndex);
+	if (!Placement) return;
+	const int32 UpperLeftIndex = GetGridModel().GetUpperLeftIndex(GridIndex);
+	const FIntPoint Dimensions = Placement->Dimensions;
 
-	// 아이템이 차지하는 모든 슬롯을 초기화합니다
-	UInv_InventoryStatics::ForEach2D(GridSlots, GridIndex, GridFragment->GetGridSize(), Columns, [&](UInv_GridSlot* GridSlot)
+	// 그리드 모델에서 아이템을 제거합니다
+	InventoryComponent->RemoveItemFromGrid(InventoryItem, UpperLeftIndex);
+
+	// 아이템이 차지하던 슬롯 중 보이는 슬롯을 비어있는 상태로 표시합니다
+	ForEachVisibleCell(UpperLeftIndex, Dimensions, [this](const int32 CellIndex)
 	{
-		GridSlot->SetInventoryItem(nullptr);
-		GridSlot->SetUpperLeftGridIndex(INDEX_NONE);
-		GridSlot->SetUnoccupiedTexture();
-		GridSlot->SetAvailable(true);
-		GridSlot->SetStackCount(0);
+		SetCellState(CellIndex, EInv_GridSlotState::Unoccupied);
 	});
 
-	// 슬롯 아이템 위젯을 제거합니다
-	if (SlottedItems.Contains(GridIndex))
+	// 슬롯 아이템 위젯을 회수합니다
+	TObjectPtr<UInv_SlottedItem> FoundSlottedItem;
+	if (SlottedItems.RemoveAndCopyValue(UpperLeftIndex, FoundSlottedItem))
 	{
-		TObjectPtr<UInv_SlottedItem> FoundSlottedItem;
-		SlottedItems.RemoveAndCopyValue(GridIndex, FoundSlottedItem);
-		FoundSlottedItem->RemoveFromParent();
+		ReleaseSlottedItem(FoundSlottedItem);
 	}
+	if (IsValid(GridRenderer))
+	{
+		GridRenderer->RemoveItem(UpperLeftIndex);
+	}
+
+	// 그리드 내용이 바뀌었으므로 호버 아이템의 하이라이트를 다시 계산합니다
+	RefreshHoverQuery();
 }
 
 void UInv_InventoryGrid::UpdateTileParameters(const FVector2D& CanvasPosition, const FVector2D& MousePosition)
@@ -662,12 +838,18 @@ void UInv_InventoryGrid::UpdateTileParameters(const FVector2D& CanvasPosition, c
 	OnTileParametersUpdated(TileParameters);
 }
 
+void UInv_InventoryGrid::RefreshHoverQuery()
+{
+	if (!bGridConstructed) return;
+	UpdateTileParameters(FVector2D::ZeroVector, LastCanvasMousePosition);
+}
+
 FIntPoint UInv_InventoryGrid::CalculateHoveredCoordinates(const FVector2D& CanvasPosition, const FVector2D& MousePosition) const
 {
-	// 마우스 위치로부터 타일 좌표를 계산합니다
+	// 마우스 위치로부터 타일 좌표를 계산합니다 (스크롤된 행 수만큼 그리드 좌표로 보정)
 	return FIntPoint{
 		static_cast<int32>(FMath::FloorToInt((MousePosition.X - CanvasPosition.X) / TileSize)),
-		static_cast<int32>(FMath::FloorToInt((MousePosition.Y - CanvasPosition.Y) / TileSize))
+		static_cast<int32>(FMath::FloorToInt((MousePosition.Y - CanvasPosition.Y) / TileSize)) + FirstVisibleRow
 	};
 }
 
@@ -700,6 +882,15 @@ void UInv_InventoryGrid::OnTileParametersUpdated(const FInv_TileParameters& Para
 	// 호버 아이템의 크기를 가져옵니다
 	const FIntPoint Dimensions = HoverItem->GetGridDimensions();
 
+	// 타일, 사분면, 아이템 크기, 그리드 내용이 모두 그대로라면 이전 결과와 하이라이트가 그대로 유효합니다
+	const uint32 Revision = GetGridModel().GetRevision();
+	if (bHoverQueryValid && Parameters == QueriedTileParameters && Dimensions == QueriedDimensions && Revision == QueriedRevision) return;
+
+	QueriedTileParameters = Parameters;
+	QueriedDimensions = Dimensions;
+	QueriedRevision = Revision;
+	bHoverQueryValid = true;
+
 	// 아이템의 좌상단 시작 좌표를 계산합니다 (사분면 기반)
 	// 마우스가 타일의 어느 사분면에 있는지에 따라 아이템이 중심을 맞춰 배치됩니다
 	const FIntPoint StartingCoordinate = CalculateStartingCoordinate(Parameters.TileCoordinats, Dimensions, Parameters.TileQuadrant);
@@ -715,16 +906,16 @@ void UInv_InventoryGrid::OnTileParametersUpdated(const FInv_TileParameters& Para
 		return;
 	}
 	// 배치 불가능한 경우: 이전 하이라이트 제거
-	UnHighlightSlots(LastHighlightedIndex, LastHighlightedDimensions);
+	ClearHighlight();
 
 	// 배치하려는 위치에 다른 아이템이 있는 경우: 해당 아이템을 회색으로 표시
 	// (교환 가능하다는 시각적 피드백)
-	if (CurrentQueryResult.ValidItem.IsValid() && GridSlots.IsValidIndex(CurrentQueryResult.UpperLeftIndex))
+	if (CurrentQueryResult.ValidItem.IsValid() && IsValidGridIndex(CurrentQueryResult.UpperLeftIndex))
 	{
-		const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(CurrentQueryResult.ValidItem.Get(), FragmentTags::GridFragment);
-		if (!GridFragment) return;
+		const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(CurrentQueryResult.UpperLeftIndex);
+		if (!Placement) return;
 
-		ChangeHoverType(CurrentQueryResult.UpperLeftIndex, GridFragment->GetGridSize(), EInv_GridSlotState::GrayedOut);
+		ChangeHoverType(CurrentQueryResult.UpperLeftIndex, Placement->Dimensions, EInv_GridSlotState::GrayedOut);
 	}
 }
 
@@ -736,6 +927,14 @@ void UInv_InventoryGrid::OnInventoryMenuToggled(bool bOpen)
 	}
 }
 
+void UInv_InventoryGrid::OnGridRearranged(EInv_ItemCategory Category)
+{
+	if (!bGridConstructed || Category != ItemCategory) return;
+
+	// 보이는 슬롯과 아이템 위젯을 그리드 모델의 새 배치대로 다시 그립니다
+	RefreshVisibleWindow();
+}
+
 FIntPoint UInv_InventoryGrid::CalculateStartingCoordinate(const FIntPoint& Coordinate, const FIntPoint& Dimensions, const EInv_TileQuadrant Quadrant) const
 {
 	// 아이템 크기가 짝수인지 확인 (짝수면 1, 홀수면 0)
@@ -777,34 +976,8 @@ FIntPoint UInv_InventoryGrid::CalculateStartingCoordinate(const FIntPoint& Coord
 
 FInv_SpaceQueryResult UInv_InventoryGrid::CheckHoverPosition(const FIntPoint& Position, const FIntPoint& Dimensions)
 {
-	FInv_SpaceQueryResult Result;
-
-	// 그리드 경계 내에 있는지 확인
-	if (!IsInGridBounds(UInv_WidgetUtils::GetIndexFromPosition(Position, Columns), Dimensions)) return Result;
-
-	Result.bHasSpace = true;
-
-	// 아이템이 차지할 영역에 있는 모든 기존 아이템의 좌상단 인덱스를 수집합니다
-	// 여러 슬롯을 점유하는 아이템이 있을 경우, 모두 동일한 좌상단 인덱스를 가지는지 확인하기 위함입니다
-	TSet<int32> OccupiedUpperLeftIndices;
-	UInv_InventoryStatics::ForEach2D(GridSlots, UInv_WidgetUtils::GetIndexFromPosition(Position, Columns), Dimensions, Columns, [&](const UInv_GridSlot* GridSlot)
-	{
-		if (GridSlot->GetInventoryItem().IsValid())
-		{
-			OccupiedUpperLeftIndices.Add(GridSlot->GetUpperLeftGridIndex());
-			Result.bHasSpace = false;
-		}
-	});
-
-	// 정확히 하나의 아이템만 영역을 점유하고 있다면, 해당 아이템과 교환하거나 결합할 수 있습니다
-	if (OccupiedUpperLeftIndices.Num() == 1)
-	{
-		const int32 Index = *OccupiedUpperLeftIndices.CreateConstIterator();
-		Result.ValidItem = GridSlots[Index]->GetInventoryItem();
-		Result.UpperLeftIndex = GridSlots[Index]->GetUpperLeftGridIndex();
-	}
-
-	return Result;
+	// 영역이 비어있는지, 교환 가능한 단일 아이템이 있는지 그리드 모델에서 확인합니다
+	return GetGridModel().CheckHoverPosition(Position, Dimensions);
 }
 
 bool UInv_InventoryGrid::CursorExitedCanvas(const FVector2D& BoundaryPos, const FVector2D& BoundarySize, const FVector2D& Location)
@@ -816,7 +989,8 @@ bool UInv_InventoryGrid::CursorExitedCanvas(const FVector2D& BoundaryPos, const
 	// 캔버스를 벗어났으면 하이라이트를 해제합니다
 	if (!bMouseWithinCanvas && bLastMouseWithinCanvas)
 	{
-		UnHighlightSlots(LastHighlightedIndex, LastHighlightedDimensions);
+		ClearHighlight();
+		bHoverQueryValid = false;
 		return true;
 	}
 	return false;
@@ -827,64 +1001,97 @@ void UInv_InventoryGrid::HighlightSlots(const int32 Index, const FIntPoint& Dime
 	// 마우스가 캔버스 밖에 있으면 무시
 	if (!bMouseWithinCanvas) return;
 
-	// 이전 하이라이트를 해제하고 새로운 슬롯들을 하이라이트합니다
-	UnHighlightSlots(LastHighlightedIndex, LastHighlightedDimensions);
-	UInv_InventoryStatics::ForEach2D(GridSlots, Index, Dimensions, Columns, [&](UInv_GridSlot* GridSlot)
-	{
-		GridSlot->SetOccupiedTexture();
-	});
-	LastHighlightedDimensions = Dimensions;
-	LastHighlightedIndex = Index;
+	// 이전 하이라이트와의 차이만 갱신해 새 영역을 하이라이트합니다
+	UpdateHighlight(Index, Dimensions, EInv_GridSlotState::Occupied);
 }
 
 void UInv_InventoryGrid::UnHighlightSlots(const int32 Index, const FIntPoint& Dimensions)
 {
-	// 슬롯들의 하이라이트를 해제하고 원래 상태로 되돌립니다
-	UInv_InventoryStatics::ForEach2D(GridSlots, Index, Dimensions, Columns, [&](UInv_GridSlot* GridSlot)
+	// 슬롯들의 하이라이트를 해제하고 그리드 모델의 점유 상태로 되돌립니다
+	const FInv_GridModel& GridModel = GetGridModel();
+	ForEachVisibleCell(Index, Dimensions, [&](const int32 CellIndex)
 	{
-		if (GridSlot->IsAvailable())
-		{
-			GridSlot->SetUnoccupiedTexture();
-		}
-		else
-		{
-			GridSlot->SetOccupiedTexture();
-		}
+		SetCellState(CellIndex, GridModel.IsOccupied(CellIndex) ? EInv_GridSlotState::Occupied : EInv_GridSlotState::Unoccupied);
 	});
 }
 
 void UInv_InventoryGrid::ChangeHoverType(const int32 Index, const FIntPoint& Dimensions, EInv_GridSlotState GridSlotState)
 {
-	// 이전 하이라이트를 해제하고 새로운 상태로 변경합니다
-	UnHighlightSlots(LastHighlightedIndex, LastHighlightedDimensions);
-	UInv_InventoryStatics::ForEach2D(GridSlots, Index, Dimensions, Columns, [State = GridSlotState](UInv_GridSlot* GridSlot)
+	// 이전 하이라이트와의 차이만 갱신해 새로운 상태로 변경합니다
+	UpdateHighlight(Index, Dimensions, GridSlotState);
+}
+
+void UInv_InventoryGrid::UpdateHighlight(const int32 Index, const FIntPoint& Dimensions, const EInv_GridSlotState GridSlotState)
+{
+	const FIntPoint Position = UInv_WidgetUtils::GetPositionFromIndex(Index, Columns);
+
+	// 하이라이트 레이어가 있으면 캐시된 셀은 그대로 두고 레이어의 영역만 옮깁니다
+	if (IsValid(HighlightLayer))
 	{
-		switch (State)
-		{
-		case EInv_GridSlotState::Occupied:
-			GridSlot->SetOccupiedTexture();
-			break;
-		case EInv_GridSlotState::Unoccupied:
-			GridSlot->SetUnoccupiedTexture();
-			break;
-		case EInv_GridSlotState::GrayedOut:
-			GridSlot->SetGrayedOutTexture();
-			break;
-		case EInv_GridSlotState::Selected:
-			GridSlot->SetSelectedTexture();
-			break;
-		}
+		const FIntPoint WindowPosition = Position - FIntPoint(0, FirstVisibleRow);
+		FIntRect WindowRect(WindowPosition, WindowPosition + Dimensions);
+		WindowRect.Clip(FIntRect(0, 0, Columns, GetNumVisibleRows()));
+		HighlightLayer->SetHighlight(WindowRect, GridSlotState);
+
+		LastHighlightedIndex = Index;
+		LastHighlightedDimensions = Dimensions;
+		LastHighlightedState = GridSlotState;
+		return;
+	}
+
+	const FIntRect NewRect(Position, Position + Dimensions);
+	const FIntPoint LastPosition = UInv_WidgetUtils::GetPositionFromIndex(LastHighlightedIndex, Columns);
+	const FIntRect LastRect(LastPosition, LastPosition + LastHighlightedDimensions);
+
+	// 겹치는 셀이 이미 같은 상태로 칠해져 있으면 새 영역에서 건너뜁니다
+	const bool bSkipOverlap = bLastHighlightIntact && GridSlotState == LastHighlightedState;
+
+	// 아래의 셀 갱신이 하이라이트 기록을 무효화하지 않도록 먼저 내려둡니다
+	bLastHighlightIntact = false;
+
+	// 새 영역 밖으로 벗어난 이전 셀만 그리드 모델의 점유 상태로 되돌립니다
+	const FInv_GridModel& GridModel = GetGridModel();
+	ForEachVisibleCell(LastHighlightedIndex, LastHighlightedDimensions, [&](const int32 CellIndex)
+	{
+		if (NewRect.Contains(UInv_WidgetUtils::GetPositionFromIndex(CellIndex, Columns))) return;
+		SetCellState(CellIndex, GridModel.IsOccupied(CellIndex) ? EInv_GridSlotState::Occupied : EInv_GridSlotState::Unoccupied);
+	});
+
+	// 새로 들어온 셀과 (상태가 바뀌었다면) 겹치는 셀에 새 상태를 적용합니다
+	ForEachVisibleCell(Index, Dimensions, [&](const int32 CellIndex)
+	{
+		if (bSkipOverlap && LastRect.Contains(UInv_WidgetUtils::GetPositionFromIndex(CellIndex, Columns))) return;
+		SetCellState(CellIndex, GridSlotState);
 	});
 
 	LastHighlightedIndex = Index;
 	LastHighlightedDimensions = Dimensions;
+	LastHighlightedState = GridSlotState;
+	bLastHighlightIntact = true;
+}
+
+void UInv_InventoryGrid::ClearHighlight()
+{
+	// 마지막 하이라이트를 해제하고 영역을 비워 다음 하이라이트가 되돌릴 셀이 없도록 합니다
+	if (IsValid(HighlightLayer))
+	{
+		HighlightLayer->ClearHighlight();
+	}
+	else
+	{
+		bLastHighlightIntact = false;
+		UnHighlightSlots(LastHighlightedIndex, LastHighlightedDimensions);
+	}
+	LastHighlightedDimensions = FIntPoint::ZeroValue;
 }
 
 void UInv_InventoryGrid::PutDownOnIndex(const int32 Index)
 {
-	// 호버 아이템을 지정된 인덱스에 배치하고 그리드를 업데이트합니다
+	// 호버 아이템을 그리드 모델의 지정된 인덱스에 배치하고 화면을 업데이트합니다
+	// 배치할 수 없으면 호버 아이템을 그대로 들고 있습니다
+	if (!InventoryComponent->PlaceItemInGrid(HoverItem->GetInventoryItem(), Index, HoverItem->GetStackCount(), HoverItem->IsRotated())) return;
 	AddItemAtIndex(HoverItem->GetInventoryItem(), Index, HoverItem->IsStackable(), HoverItem->GetStackCount());
-	UpdateGridSlots(HoverItem->GetInventoryItem(), Index, HoverItem->IsStackable(), HoverItem->GetStackCount());
+	UpdateGridSlots(Index, HoverItem->GetGridDimensions());
 	ClearHoverItem();
 }
 
@@ -893,16 +1100,10 @@ void UInv_InventoryGrid::ClearHoverItem()
 	// 호버 아이템이 없으면 무시
 	if (!IsValid(HoverItem)) return;
 
-	// 호버 아이템의 모든 속성을 초기화합니다
-	HoverItem->SetInventoryItem(nullptr);
-	HoverItem->SetIsStackable(false);
-	HoverItem->SetPreviousGridIndex(INDEX_NONE);
-	HoverItem->UpdateStackCount(0);
-	HoverItem->SetImageBrush(FSlateNoResource());
-
-	// 호버 아이템을 제거합니다
-	HoverItem->RemoveFromParent();
+	// 호버 아이템을 위젯 풀에 반환합니다 (반환 시 모든 속성이 초기화됨)
+	UInv_WidgetPoolSubsystem::ReleaseWidget(HoverItem);
 	HoverItem = nullptr;
+	bHoverQueryValid = false;
 
 	// 커서를 다시 표시합니다
 	ShowCursor();
@@ -950,18 +1151,33 @@ void UInv_InventoryGrid::SwapWithHoverItem(UInv_InventoryItem* ClickedInventoryI
 	// 호버 아이템이 없으면 무시
 	if (!IsValid(HoverItem)) return;
 
+	// 드롭 위치에 클릭한 아이템 하나만 겹치는지 모델에서 다시 확인합니다 (아니면 교환하지 않고 호버 아이템을 유지)
+	const int32 ClickedUpperLeftIndex = GetGridModel().GetUpperLeftIndex(GridIndex);
+	const FInv_SpaceQueryResult DropQuery = GetGridModel().CheckHoverPosition(UInv_WidgetUtils::GetPositionFromIndex(ItemDropIndex, Columns), HoverItem->GetGridDimensions());
+	if (ClickedUpperLeftIndex == INDEX_NONE || DropQuery.UpperLeftIndex != ClickedUpperLeftIndex) return;
+
 	// 호버 아이템의 정보를 임시 변수에 저장합니다
 	UInv_InventoryItem* TempInventoryItem = HoverItem->GetInventoryItem();
 	const int32 TempStackCount = HoverItem->GetStackCount();
 	const bool bTempIsStackable = HoverItem->IsStackable();
+	const bool bTempIsRotated = HoverItem->IsRotated();
 
 	// 클릭한 아이템을 호버 아이템으로 설정하고 (이전 그리드 인덱스는 유지)
 	AssignHoverItem(ClickedInventoryItem, GridIndex, HoverItem->GetPreviousGridIndex());
 	// 클릭한 위치에서 아이템을 제거한 후
 	RemoveItemFromGrid(ClickedInventoryItem, GridIndex);
 	// 임시 저장한 아이템을 ItemDropIndex 위치에 배치합니다
+	if (!InventoryComponent->PlaceItemInGrid(TempInventoryItem, ItemDropIndex, TempStackCount, bTempIsRotated))
+	{
+		// 배치할 수 없으면 첫 번째로 맞는 위치에 되돌려 아이템을 잃지 않게 합니다
+		AddStacks(InventoryComponent->AddItemToGrid(TempInventoryItem, TempStackCount));
+		return;
+	}
 	AddItemAtIndex(TempInventoryItem, ItemDropIndex, bTempIsStackable, TempStackCount);
-	UpdateGridSlots(TempInventoryItem, ItemDropIndex, bTempIsStackable, TempStackCount);
+	if (const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(ItemDropIndex))
+	{
+		UpdateGridSlots(ItemDropIndex, Placement->Dimensions);
+	}
 }
 
 bool UInv_InventoryGrid::ShouldSwapStackCounts(const int32 RoomInClickedSlot, const int32 HoveredStackCount, const int32 MaxStackSize) const
@@ -974,12 +1190,10 @@ bool UInv_InventoryGrid::ShouldSwapStackCounts(const int32 RoomInClickedSlot, co
 void UInv_InventoryGrid::SwapStackCounts(const int32 ClickedStackCount, const int32 HoveredStackCount, const int32 Index)
 {
 	// 클릭한 슬롯의 스택 수량을 호버 아이템의 수량으로 설정
-	UInv_GridSlot* GridSlot = GridSlots[Index];
-	GridSlot->SetStackCount(HoveredStackCount);
+	InventoryComponent->SetGridStackCount(GetGridModel().GetItem(Index), Index, HoveredStackCount);
 
 	// 슬롯 아이템 위젯의 스택 표시도 업데이트
-	UInv_SlottedItem* ClickedSlottedItem = SlottedItems.FindChecked(Index);
-	ClickedSlottedItem->UpdateStackCount(HoveredStackCount);
+	UpdateSlottedItemStackCount(Index, HoveredStackCount);
 
 	// 호버 아이템의 스택 수량을 클릭한 슬롯의 수량으로 설정
 	HoverItem->UpdateStackCount(ClickedStackCount);
@@ -1000,10 +1214,10 @@ void UInv_InventoryGrid::ConsumeHoverItemStacks(const int32 ClickedStackCount, c
 	const int32 NewClickedStackCount = ClickedStackCount + AmountToTransfer;
 	// 예: 클릭한 슬롯 40개 + 호버 20개 = 60개
 
-	// 그리드 슬롯의 스택 수량을 업데이트합니다
-	GridSlots[Index]->SetStackCount(NewClickedStackCount);
+	// 그리드 모델의 스택 수량을 업데이트합니다
+	InventoryComponent->SetGridStackCount(GetGridModel().GetItem(Index), Index, NewClickedStackCount);
 	// 슬롯 아이템 위젯의 표시도 업데이트합니다
-	SlottedItems.FindChecked(Index)->UpdateStackCount(NewClickedStackCount);
+	UpdateSlottedItemStackCount(Index, NewClickedStackCount);
 
 	// 호버 아이템의 모든 스택이 소비되었으므로 호버 아이템을 완전히 제거합니다
 	ClearHoverItem();
@@ -1011,8 +1225,8 @@ void UInv_InventoryGrid::ConsumeHoverItemStacks(const int32 ClickedStackCount, c
 	ShowCursor();
 
 	// 스택이 추가된 슬롯을 하이라이트하여 시각적 피드백을 제공합니다
-	const FInv_GridFragment* GridFragment = GridSlots[Index]->GetInventoryItem()->GetItemManifest().GetFragmentOfType<FInv_GridFragment>();
-	const FIntPoint Dimensions = GridFragment ? GridFragment->GetGridSize() : FIntPoint(1, 1);
+	const FInv_GridPlacement* Placement = GetGridModel().FindPlacement(Index);
+	const FIntPoint Dimensions = Placement ? Placement->Dimensions : FIntPoint(1, 1);
 	HighlightSlots(Index, Dimensions);
 }
 
@@ -1027,16 +1241,14 @@ bool UInv_InventoryGrid::ShouldFillInStack(const int32 RoomInClickedSlot, const
 void UInv_InventoryGrid::FillInStack(const int32 FillAmount, const int32 Remainder, const int32 Index)
 {
 	// 클릭한 슬롯을 최대치까지 채웁니다
-	UInv_GridSlot* GridSlot = GridSlots[Index];
-	const int32 NewStackCount = GridSlot->GetStackCount() + FillAmount;
+	const int32 NewStackCount = GetGridModel().GetStackCount(Index) + FillAmount;
 	// 예: 클릭한 슬롯 50개 + 채울 수량 14개 = 64개 (최대치)
 
-	// 그리드 슬롯의 스택 수량을 업데이트합니다
-	GridSlot->SetStackCount(NewStackCount);
+	// 그리드 모델의 스택 수량을 업데이트합니다
+	InventoryComponent->SetGridStackCount(GetGridModel().GetItem(Index), Index, NewStackCount);
 
 	// 슬롯 아이템 위젯의 표시도 업데이트합니다
-	UInv_SlottedItem* ClickedSlottedItem = SlottedItems.FindChecked(Index);
-	ClickedSlottedItem->UpdateStackCount(NewStackCount);
+	UpdateSlottedItemStackCount(Index, NewStackCount);
 
 	// 호버 아이템에는 남은 수량만 유지합니다
 	// 예: 원래 호버 20개 - 채운 14개 = 6개 남음
@@ -1046,14 +1258,22 @@ void UInv_InventoryGrid::FillInStack(const int32 FillAmount, const int32 Remaind
 void UInv_InventoryGrid::CreateItemPopUp(const int32 GridIndex)
 {
 	// 우클릭한 아이템을 가져옵니다
-	UInv_InventoryItem* RightClickedItem = GridSlots[GridIndex]->GetInventoryItem().Get();
+	UInv_InventoryItem* RightClickedItem = GetGridModel().GetItem(GridIndex);
 	if (!IsValid(RightClickedItem)) return;
-	// 이미 팝업이 표시되어 있다면 무시합니다
-	if (IsValid(GridSlots[GridIndex]->GetItemPopUp())) return;
+	// 이미 팝업이 표시되어 있다면 무시합니다 (슬롯 위젯이 없는 배치 렌더러는 그리드의 팝업으로 확인)
+	UInv_GridSlot* GridSlot = GetGridSlot(GridIndex);
+	if (IsValid(GridSlot) ? IsValid(GridSlot->GetItemPopUp()) : IsValid(ItemPopUp) && IsValid(ItemPopUp->GetParent())) return;
 
-	// 아이템 팝업 위젯을 생성하고 그리드 슬롯에 참조를 저장합니다
-	ItemPopUp = CreateWidget<UInv_ItemPopUp>(this, ItemPopUpClass);
-	GridSlots[GridIndex]->SetItemPopUp(ItemPopUp);
+	// 아이템 팝업 위젯을 위젯 풀에서 꺼내고 그리드 슬롯에 참조를 저장합니다
+	ItemPopUp = UInv_WidgetPoolSubsystem::AcquireWidget<UInv_ItemPopUp>(GetOwningPlayer(), ItemPopUpClass);
+	if (IsValid(GridSlot))
+	{
+		GridSlot->SetItemPopUp(ItemPopUp);
+	}
+	else
+	{
+		ItemPopUp->SetGridIndex(GridIndex);
+	}
 
 	// 팝업을 캔버스에 추가하고 마우스 위치에 표시합니다
 	OwningCanvasPanel->AddChild(ItemPopUp);
@@ -1063,12 +1283,13 @@ void UInv_InventoryGrid::CreateItemPopUp(const int32 GridIndex)
 	CanvasSlot->SetSize(ItemPopUp->GetBoxSize());
 
 	// 스택 분할 옵션을 설정합니다 (스택 가능한 아이템이고 2개 이상인 경우만)
-	const int32 SliderMax = GridSlots[GridIndex]->GetStackCount() - 1;
+	const int32 StackCount = GetGridModel().GetStackCount(GridIndex);
+	const int32 SliderMax = StackCount - 1;
 	if (RightClickedItem->IsStackable() && SliderMax > 0)
 	{
 		// 분할 버튼의 콜백을 바인딩하고 슬라이더 범위를 설정합니다
 		ItemPopUp->OnSplit.BindDynamic(this, &ThisClass::OnPopUpMenuSplit);
-		ItemPopUp->SetSliderParams(SliderMax, FMath::Max(1, GridSlots[GridIndex]->GetStackCount() / 2));
+		ItemPopUp->SetSliderParams(SliderMax, FMath::Max(1, StackCount / 2));
 	}
 	else
 	{
@@ -1095,63 +1316,71 @@ void UInv_InventoryGrid::PutHoverItemBack()
 {
 	if (!IsValid(HoverItem)) return;
 
-	FInv_SlotAvailabilityResult Result = HasRoomForItem(HoverItem->GetInventoryItem(), HoverItem->GetStackCount());
-	Result.Item = HoverItem->GetInventoryItem();
-
+	// 그리드 모델에서 첫 번째로 맞는 위치에 되돌려 놓고, 그 결과를 화면에 표시합니다
+	const FInv_SlotAvailabilityResult Result = InventoryComponent->AddItemToGrid(HoverItem->GetInventoryItem(), HoverItem->GetStackCount());
 	AddStacks(Result);
 	ClearHoverItem();
 }
 
 void UInv_InventoryGrid::AssignHoverItem(UInv_InventoryItem* InventoryItem)
 {
-	// 호버 아이템이 없으면 생성합니다
+	// 호버 아이템이 없으면 위젯 풀에서 꺼냅니다
 	if (!IsValid(HoverItem))
 	{
-		HoverItem = CreateWidget<UInv_HoverItem>(GetOwningPlayer(), HoverItemClass);
+		HoverItem = UInv_WidgetPoolSubsystem::AcquireWidget<UInv_HoverItem>(GetOwningPlayer(), HoverItemClass);
 	}
+	bHoverQueryValid = false;
 
 	// 아이템의 프래그먼트를 가져옵니다
 	const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(InventoryItem, FragmentTags::GridFragment);
 	const FInv_ImageFragment* ImageFragment = GetFragment<FInv_ImageFragment>(InventoryItem, FragmentTags::IconFragment);
 	if (!GridFragment || !ImageFragment) return;
 
-	// 아이콘의 그릴 크기를 계산합니다
-	const FVector2D DrawSize = GetDrawSize(GridFragment);
-
-	// 아이콘 브러시를 설정합니다
-	FSlateBrush IconBrush;
-	IconBrush.SetResourceObject(ImageFragment->GetIcon());
-	IconBrush.DrawAs = ESlateBrushDrawType::Image;
-	IconBrush.ImageSize = DrawSize * UWidgetLayoutLibrary::GetViewportScale(this);
+	// 커서 위젯은 DPI 스케일이 적용되지 않으므로 뷰포트 스케일을 곱한 캐시 브러시를 사용합니다
+	HoverItem->SetImageBrush(GetIconBrush(GridFragment, ImageFragment, ViewportScale));
 
 	// 호버 아이템의 속성을 설정합니다
-	HoverItem->SetImageBrush(IconBrush);
 	HoverItem->SetGridDimensions(GridFragment->GetGridSize());
+	HoverItem->SetRotated(false);
 	HoverItem->SetInventoryItem(InventoryItem);
 	HoverItem->SetIsStackable(InventoryItem->IsStackable());
 
-	// 마우스 커서 위젯으로 설정합니다
+	// 마우스 커서 위젯으로 설정합니다 (커서를 따라 매 프레임 움직이므로 캐시하지 않음)
+	HoverItem->ForceVolatile(true);
 	GetOwningPlayer()->SetMouseCursorWidget(EMouseCursor::Default, HoverItem);
 }
 
 
 
-FVector2D UInv_InventoryGrid::GetDrawSize(const FInv_GridFragment* GridFragment) const
+void UInv_InventoryGrid::RotateHoverItem()
+{
+	if (!IsValid(HoverItem)) return;
+
+	const FInv_GridFragment* GridFragment = GetFragment<FInv_GridFragment>(HoverItem->GetInventoryItem(), FragmentTags::GridFragment);
+	if (!GridFragment || !GridFragment->CanRotate()) return;
+
+	// 크기가 바뀌므로 호버 위치 검사와 하이라이트를 새 방향으로 다시 계산합니다
+	HoverItem->SetRotated(!HoverItem->IsRotated());
+	RefreshHoverQuery();
+}
+
+FVector2D UInv_InventoryGrid::GetDrawSize(const FInv_GridFragment* GridFragment, const bool bRotated) const
 {
 	// 패딩을 제외한 타일 크기를 계산하고 아이템 크기를 곱합니다
 	const float IconTileWidth = TileSize - GridFragment->GetGridPadding() * 2;
-	return GridFragment->GetGridSize() * IconTileWidth;
+	return GridFragment->GetGridSize(bRotated) * IconTileWidth;
+}
+
+const FSlateBrush& UInv_InventoryGrid::GetIconBrush(const FInv_GridFragment* GridFragment, const FInv_ImageFragment* ImageFragment, const float Scale) const
+{
+	// 회전하지 않은 방향의 그릴 크기 (GetDrawSize와 같은 계산)로 캐시된 브러시를 가져옵니다
+	return IconBrushCache.FindOrAdd(ImageFragment->GetIcon(), GridFragment->GetGridSize(), GridFragment->GetGridPadding(), TileSize, Scale);
 }
 
 void UInv_InventoryGrid::SetSlottedItemImage(const UInv_SlottedItem* SlottedItem, const FInv_GridFragment* GridFragment, const FInv_ImageFragment* ImageFragment) const
 {
 	// 슬롯 아이템의 이미지 브러시를 설정합니다
-	FSlateBrush Brush;
-	Brush.SetResourceObject(ImageFragment->GetIcon());
-	Brush.DrawAs = ESlateBrushDrawType::Image;
-	Brush.ImageSize = GetDrawSize(GridFragment);
-
-	SlottedItem->SetImageBrush(Brush);
+	SlottedItem->SetImageBrush(GetIconBrush(GridFragment, ImageFragment));
 }
 
 
@@ -1159,32 +1388,81 @@ void UInv_InventoryGrid::SetSlottedItemImage(const UInv_SlottedItem* SlottedItem
 
 void UInv_InventoryGrid::ConstructGrid()
 {
-	// 그리드 슬롯 배열의 공간을 미리 할당합니다
-	GridSlots.Reserve(Rows * Columns);
+	// 그리드 크기는 인벤토리 컴포넌트의 그리드 모델을 따릅니다
+	const FInv_GridModel& GridModel = GetGridModel();
+	if (GridModel.IsInitialized() && (Rows != GridModel.GetRows() || Columns != GridModel.GetColumns()))
+	{
+		UE_LOG(LogInventory, Warning, TEXT("Grid %s size (%dx%d) differs from the inventory component's grid model (%dx%d). Using the model size."),
+			*GetName(), Columns, Rows, GridModel.GetColumns(), GridModel.GetRows());
+		Rows = GridModel.GetRows();
+		Columns = GridModel.GetColumns();
+	}
+
+	// 보이는 영역의 슬롯만 할당합니다 (스크롤하면 이 슬롯들을 재사용)
+	const int32 NumVisibleRows = GetNumVisibleRows();
+	FirstVisibleRow = FMath::Clamp(FirstVisibleRow, 0, FMath::Max(Rows - NumVisibleRows, 0));
 
-	// 모든 행과 열에 대해 그리드 슬롯을 생성합니다
-	for (int32 j = 0; j < Rows; ++j)
+	// 배치 렌더러를 사용하면 슬롯 위젯 대신 렌더러 하나를 보이는 영역 크기로 배치합니다
+	if (bUseBatchedRenderer)
 	{
-		for (int32 i = 0; i < Columns; ++i)
+		GridRenderer = NewObject<UInv_GridRenderer>(this);
+		CellCanvasPanel->AddChild(GridRenderer);
+		UCanvasPanelSlot* RendererCPS = UWidgetLayoutLibrary::SlotAsCanvasSlot(GridRenderer);
+		RendererCPS->SetSize(FVector2D(Columns, NumVisibleRows) * TileSize);
+		RendererCPS->SetPosition(FVector2D::ZeroVector);
+
+		GridRenderer->InitializeGrid(Columns, NumVisibleRows, TileSize, GridSlotClass.GetDefaultObject(), RendererStackCountFont);
+		GridRenderer->OnCellClicked.BindUObject(this, &ThisClass::OnRendererCellClicked);
+		GridRenderer->OnHoveredCellChanged.BindUObject(this, &ThisClass::OnRendererHoveredCellChanged);
+		FinishGridConstruction();
+		return;
+	}
+
+	GridSlots.Reserve(NumVisibleRows * Columns);
+	ContinueGridConstruction();
+}
+
+void UInv_InventoryGrid::ContinueGridConstruction()
+{
+	// 이번 프레임의 예산 안에서 보이는 행과 모든 열에 대해 그리드 슬롯을 생성합니다
+	const double Deadline = FPlatformTime::Seconds() + ConstructionBudgetMs * 0.001;
+	const int32 NumSlots = GetNumVisibleRows() * Columns;
+	while (GridSlots.Num() < NumSlots)
+	{
+		// 매 프레임 최소 한 행은 생성해 예산이 매우 작아도 구성이 끝나도록 합니다
+		if (GridSlots.Num() % Columns == 0 && FPlatformTime::Seconds() > Deadline)
 		{
-			// 그리드 슬롯 위젯을 생성하고 캔버스에 추가합니다
-			UInv_GridSlot* GridSlot = CreateWidget<UInv_GridSlot>(this, GridSlotClass);
-			GridCanvasPanel->AddChild(GridSlot);
-			const FIntPoint TilePosition(i, j);
-			GridSlot->SetTileIndex(UInv_WidgetUtils::GetIndexFromPosition(TilePosition, Columns));
-
-			// 슬롯의 크기와 위치를 설정합니다
-			UCanvasPanelSlot* GridCPS = UWidgetLayoutLibrary::SlotAsCanvasSlot(GridSlot);
-			GridCPS->SetSize(FVector2D(TileSize));
-			GridCPS->SetPosition(TilePosition * TileSize);
-
-			// 이벤트를 바인딩하고 배열에 추가합니다
-			GridSlots.Add(GridSlot);
-			GridSlot->GridSlotClicked.AddDynamic(this, &ThisClass::OnGridSlotClicked);
-			GridSlot->GridSlotHovered.AddDynamic(this, &ThisClass::OnGridSlotHovered);
-			GridSlot->GridSlotUnhovered.AddDynamic(this, &ThisClass::OnGridSlotUnhovered);
+			GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::ContinueGridConstruction);
+			return;
 		}
+
+		// 그리드 슬롯 위젯을 생성하고 셀 레이어에 추가합니다
+		const int32 WindowIndex = GridSlots.Num();
+		UInv_GridSlot* GridSlot = CreateWidget<UInv_GridSlot>(this, GridSlotClass);
+		CellCanvasPanel->AddChild(GridSlot);
+		const FIntPoint TilePosition = UInv_WidgetUtils::GetPositionFromIndex(WindowIndex, Columns);
+		GridSlot->SetTileIndex(WindowIndex + FirstVisibleRow * Columns);
+
+		// 슬롯의 크기와 위치를 설정합니다
+		UCanvasPanelSlot* GridCPS = UWidgetLayoutLibrary::SlotAsCanvasSlot(GridSlot);
+		GridCPS->SetSize(FVector2D(TileSize));
+		GridCPS->SetPosition(TilePosition * TileSize);
+
+		// 이벤트를 바인딩하고 배열에 추가합니다
+		GridSlots.Add(GridSlot);
+		GridSlot->GridSlotClicked.AddDynamic(this, &ThisClass::OnGridSlotClicked);
+		GridSlot->GridSlotHovered.AddDynamic(this, &ThisClass::OnGridSlotHovered);
+		GridSlot->GridSlotUnhovered.AddDynamic(this, &ThisClass::OnGridSlotUnhovered);
 	}
+
+	FinishGridConstruction();
+}
+
+void UInv_InventoryGrid::FinishGridConstruction()
+{
+	// 구성 전에 복제되어 그리드 모델에만 있던 아이템들을 포함해 모델의 배치대로 그립니다
+	bGridConstructed = true;
+	RefreshVisibleWindow();
 }
 
 bool UInv_InventoryGrid::MatchesCategory(const UInv_InventoryItem* Item) const
@@ -16,6 +16,7 @@
 #include "Widgets/Inventory/HoverItem/Inv_HoverItem.h"
 #include "Widgets/Inventory/SlottedItems/Inv_EquippedSlottedItem.h"
 #include "Widgets/Inventory/Spatial/Inv_InventoryGrid.h"
+#include "Widgets/Pool/Inv_WidgetPoolSubsystem.h"
 
 /**
  * 위젯 초기화 함수
@@ -28,6 +29,8 @@
  *    - 제작 재료 버튼 -> ShowCraftables()
  * 3. 각 그리드에 캔버스 패널 설정 (호버 아이템 표시용)
  * 4. 기본 그리드로 장비 그리드를 표시
+ *
+ * 그리드 슬롯은 여기서 만들지 않고, 메뉴가 열린 상태에서 탭이 처음 표시될 때 만듭니다
  */
 void UInv_SpatialInventory::NativeOnInitialized()
 {
@@ -37,12 +40,22 @@ void UInv_SpatialInventory::NativeOnInitialized()
 	Button_Equippables->OnClicked.AddDynamic(this, &ThisClass::ShowEquippables);
 	Button_Consumables->OnClicked.AddDynamic(this, &ThisClass::ShowConsumables);
 	Button_Craftables->OnClicked.AddDynamic(this, &ThisClass::ShowCraftables);
+	if (IsValid(Button_Tidy))
+	{
+		Button_Tidy->OnClicked.AddDynamic(this, &ThisClass::TidyInventory);
+	}
 
 	// 각 그리드에 소유 캔버스를 설정합니다 (호버 아이템을 표시하기 위함)
 	Grid_Equippables->SetOwningCanvas(CanvasPanel);
 	Grid_Consumables->SetOwningCanvas(CanvasPanel);
 	Grid_Craftables->SetOwningCanvas(CanvasPanel);
 
+	// 메뉴가 열리면 활성 탭의 그리드를 구성하도록 바인딩합니다
+	if (UInv_InventoryComponent* InventoryComponent = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer()))
+	{
+		InventoryComponent->OnInventoryMenuToggled.AddDynamic(this, &ThisClass::OnInventoryMenuToggled);
+	}
+
 	// 기본적으로 장비 그리드를 표시합니다
 	ShowEquippables();
 	
@@ -55,6 +68,21 @@ void UInv_SpatialInventory::NativeOnInitialized()
 			EquippedGridSlot->EquippedGridSlotClicked.AddDynamic(this, &ThisClass::EquippedGridSlotClicked);
 		}
 	});
+
+	// 장착 아이템 아이콘은 필요할 때 스트리밍되며, 로드되는 동안 자리 표시 브러시를 사용합니다
+	EquippedIconBrushCache.SetPlaceholderBrush(EquippedIconPlaceholderBrush);
+	EquippedIconBrushCache.OnIconLoaded.BindUObject(this, &ThisClass::OnEquippedIconLoaded);
+}
+
+void UInv_SpatialInventory::OnEquippedIconLoaded()
+{
+	// 장착 아이템 위젯은 브러시 복사본을 가지므로 로드된 아이콘의 브러시로 다시 설정합니다
+	const float TileSize = GetTileSize();
+	for (UInv_EquippedGridSlot* EquippedGridSlot : EquippedGridSlots)
+	{
+		if (!IsValid(EquippedGridSlot)) continue;
+		EquippedGridSlot->RefreshEquippedItemBrush(TileSize, EquippedIconBrushCache);
+	}
 }
 
 /**
@@ -73,20 +101,23 @@ FReply UInv_SpatialInventory::NativeOnMouseButtonDown(const FGeometry& MyGeometr
 }
 
 /**
- * 매 프레임마다 호출되는 틱 함수
+ * 마우스 이동 이벤트 처리
  *
- * 아이템 설명 위젯이 표시 중일 때 마우스 커서를 따라다니도록
- * 위치를 지속적으로 업데이트합니다
+ * 아이템 설명 위젯이 표시 중일 때만 마우스 커서를 따라다니도록
+ * 위치를 업데이트합니다 (자식 위젯 위의 이동도 이 위젯까지 전달됩니다)
  *
- * 이를 통해 마우스를 움직여도 설명 위젯이 항상 커서 근처에 표시됩니다
+ * 마우스가 움직이지 않으면 위치도 바뀌지 않으므로 틱이 필요하지 않습니다
  */
-void UInv_SpatialInventory::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+FReply UInv_SpatialInventory::NativeOnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
+	UpdateItemDescriptionPositions();
+	return Super::NativeOnMouseMove(MyGeometry, MouseEvent);
+}
 
-	// 아이템 설명 위젯이 생성되어 있으면 매 프레임 위치를 업데이트합니다
-	// 마우스 커서를 따라다니도록 하기 위함입니다
-	if (!IsValid(ItemDescription)) return;
+void UInv_SpatialInventory::UpdateItemDescriptionPositions()
+{
+	// 아이템 설명이 표시 중일 때만 위치를 업데이트합니다
+	if (!IsValid(ItemDescription) || !ItemDescription->IsVisible()) return;
 	SetItemDescriptionSizeAndPosition(ItemDescription, CanvasPanel);
 	SetEquippedItemDescriptionSizeAndPosition(ItemDescription, EquippedItemDescription, CanvasPanel);
 }
@@ -139,7 +170,6 @@ FInv_SlotAvailabilityResult UInv_SpatialInventory::HasRoomForItem(UInv_ItemCompo
  */
 void UInv_SpatialInventory::OnItemHovered(UInv_InventoryItem* Item)
 {
-	const auto& Manifest = Item->GetItemManifest();
 	// 아이템 설명 위젯을 가져옵니다 (없으면 생성)
 	UInv_ItemDescription* DescriptionWidget = GetItemDescription();
 	// 일단 숨김 상태로 설정합니다
@@ -151,12 +181,16 @@ void UInv_SpatialInventory::OnItemHovered(UInv_InventoryItem* Item)
 	// 지연 후에 설명을 표시하는 람다를 타이머 델리게이트에 바인딩합니다
 	// 이를 통해 마우스를 빠르게 움직일 때는 설명이 표시되지 않습니다
 	FTimerDelegate DescriptionTimerDelegate;
-	DescriptionTimerDelegate.BindLambda([this, Item ,&Manifest, DescriptionWidget]()
+	DescriptionTimerDelegate.BindLambda([this, Item, DescriptionWidget]()
 	{
 		// HitTestInvisible로 설정하여 마우스 이벤트를 방해하지 않으면서 보이도록 합니다
 		GetItemDescription()->SetVisibility(ESlateVisibility::HitTestInvisible);
-		// 매니페스트의 모든 인벤토리 프래그먼트를 위젯에 동화시킵니다
-		Manifest.AssimilateInventoryFragments(DescriptionWidget);
+		// 아이템의 캐시된 설명 페이로드를 위젯에 적용합니다 (같은 아이템을 다시 호버하면 포맷을 다시 하지 않음)
+		Item->GetDescriptionPayload().ApplyTo(DescriptionWidget);
+
+		// 내용에 맞는 크기를 바로 계산해 마우스 커서 위치에 배치합니다 (이후에는 마우스 이동 시 갱신)
+		DescriptionWidget->ForceLayoutPrepass();
+		UpdateItemDescriptionPositions();
 		
 		FTimerDelegate EquippedDescriptionTimerDelegate;
 		EquippedDescriptionTimerDelegate.BindUObject(this, &ThisClass::ShowEquippedItemDescription, Item);
@@ -224,6 +258,19 @@ UInv_HoverItem* UInv_SpatialInventory::GetHoverItem() const
 	return ActiveGrid->GetHoverItem();
 }
 
+/**
+ * 현재 활성화된 그리드의 호버 아이템을 90도 회전합니다
+ *
+ * 호버 아이템은 활성 그리드에만 있으므로 활성 그리드에 전달합니다.
+ */
+void UInv_SpatialInventory::RotateHoverItem()
+{
+	// 활성 그리드가 유효한지 확인합니다
+	if (!ActiveGrid.IsValid()) return;
+
+	ActiveGrid->RotateHoverItem();
+}
+
 /**
  * 현재 활성화된 그리드의 타일 크기를 가져옵니다
  *
@@ -241,6 +288,12 @@ float UInv_SpatialInventory::GetTileSize() const
 	return ActiveGrid->GetTileSize();
 }
 
+void UInv_SpatialInventory::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	CastChecked<ThisClass>(InThis)->EquippedIconBrushCache.AddReferencedObjects(Collector);
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
 /**
  * 장비 그리드를 표시합니다
  *
@@ -277,6 +330,26 @@ void UInv_SpatialInventory::ShowCraftables()
 	SetActiveGrid(Grid_Craftables, Button_Craftables);
 }
 
+void UInv_SpatialInventory::OnInventoryMenuToggled(bool bOpen)
+{
+	// 메뉴가 처음 열릴 때 활성 탭의 그리드를 구성합니다 (이미 구성했다면 무시됨)
+	if (bOpen && ActiveGrid.IsValid())
+	{
+		ActiveGrid->RequestConstruction();
+	}
+}
+
+void UInv_SpatialInventory::TidyInventory()
+{
+	// 아이템을 들고 있는 동안에는 정리하지 않습니다
+	if (HasHoverItem()) return;
+
+	if (UInv_InventoryComponent* InventoryComponent = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer()))
+	{
+		InventoryComponent->TidyInventory();
+	}
+}
+
 /**
  * 장착 그리드 슬롯이 클릭되었을 때 호출됩니다
  *
@@ -306,7 +379,8 @@ void UInv_SpatialInventory::EquippedGridSlotClicked(UInv_EquippedGridSlot* Equip
 	UInv_EquippedSlottedItem* EquippedSlottedItem = EquippedGridSlot->OnItemEquipped(
 		HoverItem->GetInventoryItem(),
 		EquipmentTypeTag,
-		TileSize
+		TileSize,
+		EquippedIconBrushCache
 	);
 
 	// 장착 아이템 클릭 이벤트를 바인딩합니다
@@ -415,6 +489,7 @@ void UInv_SpatialInventory::DisableButtons(UButton* Button)
  * 3. 새 그리드의 커서를 표시합니다
  * 4. 버튼 상태를 업데이트합니다 (선택된 버튼 비활성화)
  * 5. 위젯 스위처를 통해 새 그리드를 표시합니다
+ * 6. 메뉴가 열려 있으면 새 그리드의 구성을 시작합니다
  *
  * @param Grid 활성화할 인벤토리 그리드
  * @param Button 관련된 탭 버튼
@@ -435,6 +510,13 @@ void UInv_SpatialInventory::SetActiveGrid(UInv_InventoryGrid* Grid, UButton* But
 	// 버튼 상태를 업데이트하고 위젯 스위처로 그리드를 전환합니다
 	DisableButtons(Button);
 	WidgetSwitcher->SetActiveWidget(Grid);
+
+	// 메뉴가 열려 있다면 탭이 표시되는 지금 그리드를 구성합니다 (닫혀 있으면 메뉴가 열릴 때 구성)
+	const UInv_InventoryComponent* InventoryComponent = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
+	if (ActiveGrid.IsValid() && IsValid(InventoryComponent) && InventoryComponent->IsMenuOpen())
+	{
+		ActiveGrid->RequestConstruction();
+	}
 }
 
 /**
@@ -447,7 +529,7 @@ void UInv_SpatialInventory::SetActiveGrid(UInv_InventoryGrid* Grid, UButton* But
  * 4. 화면 경계 내에서 위치를 보정합니다 (화면 밖으로 나가지 않도록)
  * 5. 계산된 위치를 캔버스 슬롯에 적용합니다
  *
- * 이 함수는 NativeTick에서 매 프레임 호출되어
+ * 이 함수는 설명이 표시될 때와 마우스가 움직일 때 호출되어
  * 마우스 커서를 따라다니는 툴팁 효과를 구현합니다
  *
  * @param Description 위치를 설정할 아이템 설명 위젯
@@ -567,7 +649,7 @@ void UInv_SpatialInventory::ClearSlotOfItem(UInv_EquippedGridSlot* EquippedGridS
  * 동작 순서:
  * 1. 위젯의 유효성을 확인합니다
  * 2. 클릭 이벤트 델리게이트가 바인딩되어 있으면 해제합니다
- * 3. 위젯을 부모 위젯(오버레이)에서 제거하여 화면에서 사라지게 합니다
+ * 3. 위젯을 부모 위젯(오버레이)에서 제거하고 위젯 풀에 반환합니다
  *
  * 델리게이트 바인딩 해제의 중요성:
  * - 메모리 누수 방지
@@ -591,8 +673,8 @@ void UInv_SpatialInventory::RemoveEquippedSlottedItem(UInv_EquippedSlottedItem*
 	{
 		EquippedSlottedItem->OnEquippedSlottedItemClicked.RemoveDynamic(this, &ThisClass::EquippedSlottedItemClicked);
 	}
-	// 부모 위젯(오버레이)에서 제거하여 화면에서 사라지게 합니다
-	EquippedSlottedItem->RemoveFromParent();
+	// 부모 위젯(오버레이)에서 제거하고 다음 장착 때 재사용하도록 위젯 풀에 반환합니다
+	UInv_WidgetPoolSubsystem::ReleaseWidget(EquippedSlottedItem);
 }
 
 /**
@@ -627,7 +709,8 @@ void UInv_SpatialInventory::MakeEquippedSlottedItem(UInv_EquippedSlottedItem* Eq
 	UInv_EquippedSlottedItem* SlottedItem = EquippedGridSlot->OnItemEquipped(
 		ItemToEquip,
 		EquippedSlottedItem->GetEquipmentTypeTag(), // 기존 아이템의 타입 태그 (Weapon, Helmet 등)
-		UInv_InventoryStatics::GetInventoryWidget(GetOwningPlayer())->GetTileSize()
+		UInv_InventoryStatics::GetInventoryWidget(GetOwningPlayer())->GetTileSize(),
+		EquippedIconBrushCache
 		);
 
 	// 새 위젯에 클릭 이벤트를 바인딩합니다
@@ -727,14 +810,17 @@ void UInv_SpatialInventory::ShowEquippedItemDescription(UInv_InventoryItem* Item
 	UInv_InventoryItem* EquippedItem = EquippedSlot->GetInventoryItem().Get();
 	if (!IsValid(EquippedItem)) return;
 
-	const auto& EquippedItemManifest = EquippedItem->GetItemManifest();
 	UInv_ItemDescription* DescriptionWidget = GetEquippedItemDescription();
 
 	auto EquippedDescriptionWidget = GetEquippedItemDescription();
 	
-	EquippedDescriptionWidget->Collapse();
+	// 이전 아이템과 달라진 위젯만 갱신됩니다 (전체를 축소했다가 다시 확장하지 않음)
 	DescriptionWidget->SetVisibility(ESlateVisibility::HitTestInvisible);	
-	EquippedItemManifest.AssimilateInventoryFragments(EquippedDescriptionWidget);
+	EquippedItem->GetDescriptionPayload().ApplyTo(EquippedDescriptionWidget);
+
+	// 내용에 맞는 크기를 바로 계산해 아이템 설명 옆에 배치합니다
+	EquippedDescriptionWidget->ForceLayoutPrepass();
+	UpdateItemDescriptionPositions();
 }
 
 UInv_ItemDescription* UInv_SpatialInventory::GetEquippedItemDescription()
@@ -743,6 +829,9 @@ UInv_ItemDescription* UInv_SpatialInventory::GetEquippedItemDescription()
 	{
 		EquippedItemDescription = CreateWidget<UInv_ItemDescription>(GetOwningPlayer(), EquippedItemDescriptionClass);
 		CanvasPanel->AddChild(EquippedItemDescription);
+
+		// 호버 레이어는 마우스를 따라 움직이므로 캐시하지 않습니다
+		EquippedItemDescription->ForceVolatile(true);
 	}
 	return EquippedItemDescription;
 }
@@ -773,6 +862,9 @@ UInv_ItemDescription* UInv_SpatialInventory::GetItemDescription()
 	{
 		ItemDescription = CreateWidget<UInv_ItemDescription>(GetOwningPlayer(), ItemDescriptionClass);
 		CanvasPanel->AddChild(ItemDescription);
+
+		// 호버 레이어는 마우스를 따라 움직이므로 캐시하지 않습니다
+		ItemDescription->ForceVolatile(true);
 	}
 	return ItemDescription;
 }
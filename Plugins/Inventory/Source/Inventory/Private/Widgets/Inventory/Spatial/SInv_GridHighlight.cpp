@@ -0,0 +1,31 @@
+#include "Widgets/Inventory/Spatial/SInv_GridHighlight.h"
+
+void SInv_GridHighlight::Construct(const FArguments& InArgs)
+{
+	HighlightData = InArgs._HighlightData;
+
+	// 하이라이트가 바뀔 때만 다시 그리므로 틱이 필요하지 않습니다
+	SetCanTick(false);
+}
+
+FVector2D SInv_GridHighlight::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// 크기는 그리드 캔버스의 슬롯이 정합니다
+	return FVector2D::ZeroVector;
+}
+
+int32 SInv_GridHighlight::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (!HighlightData.IsValid()) return LayerId;
+	const FInv_GridHighlightData& Data = *HighlightData;
+
+	// 하이라이트 영역의 각 행을 하나의 구간으로 그립니다
+	const int32 NumColumns = Data.CellRect.Width();
+	if (NumColumns <= 0) return LayerId;
+
+	for (int32 Row = Data.CellRect.Min.Y; Row < Data.CellRect.Max.Y; ++Row)
+	{
+		Data.CellBrushes.PaintRun(AllottedGeometry, OutDrawElements, LayerId, Data.TileSize, Data.State, Row, Data.CellRect.Min.X, NumColumns);
+	}
+	return LayerId;
+}
@@ -0,0 +1,164 @@
+#include "Widgets/Inventory/Spatial/SInv_GridRenderer.h"
+
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+
+void FInv_GridCellBrushes::Init(const UInv_GridSlot* BrushSource, const float TileSize)
+{
+	if (!IsValid(BrushSource)) return;
+
+	// 셀 브러시는 기존 그리드 슬롯 위젯과 같은 에셋을 사용합니다
+	for (const EInv_GridSlotState State : {EInv_GridSlotState::Unoccupied, EInv_GridSlotState::Occupied, EInv_GridSlotState::Selected, EInv_GridSlotState::GrayedOut})
+	{
+		FSlateBrush& CellBrush = CellBrushes[static_cast<uint8>(State)];
+		CellBrush = BrushSource->GetBrush(State);
+
+		FSlateBrush& RunBrush = CellRunBrushes[static_cast<uint8>(State)];
+		RunBrush = CellBrush;
+		RunBrush.ImageSize = FVector2D(TileSize);
+		RunBrush.Tiling = ESlateBrushTileType::Horizontal;
+	}
+}
+
+void FInv_GridCellBrushes::PaintRun(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const float TileSize, const EInv_GridSlotState State, const int32 Row, const int32 FirstColumn, const int32 NumColumns) const
+{
+	const FSlateBrush& Brush = CellBrushes[static_cast<uint8>(State)];
+
+	// 이미지 브러시는 타일 크기로 가로 반복하는 구간 브러시로 구간 전체를 한 번에 그립니다
+	if (Brush.DrawAs == ESlateBrushDrawType::Image)
+	{
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2D(NumColumns * TileSize, TileSize), FSlateLayoutTransform(FVector2D(FirstColumn, Row) * TileSize)),
+			&CellRunBrushes[static_cast<uint8>(State)]);
+		return;
+	}
+
+	// 박스/테두리 브러시는 반복할 수 없으므로 셀마다 그립니다 (같은 브러시라 한 번의 드로우 콜로 묶임)
+	for (int32 Column = FirstColumn; Column < FirstColumn + NumColumns; ++Column)
+	{
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2D(TileSize), FSlateLayoutTransform(FVector2D(Column, Row) * TileSize)),
+			&Brush);
+	}
+}
+
+void SInv_GridRenderer::Construct(const FArguments& InArgs)
+{
+	RenderData = InArgs._RenderData;
+	OnCellClicked = InArgs._OnCellClicked;
+	OnHoveredCellChanged = InArgs._OnHoveredCellChanged;
+
+	// 상태가 바뀔 때만 페인트를 무효화하므로 틱이 필요하지 않습니다
+	SetCanTick(false);
+}
+
+FVector2D SInv_GridRenderer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	if (!RenderData.IsValid()) return FVector2D::ZeroVector;
+	return FVector2D(RenderData->Columns, RenderData->Rows) * RenderData->TileSize;
+}
+
+int32 SInv_GridRenderer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (!RenderData.IsValid()) return LayerId;
+	const FInv_GridRenderData& Data = *RenderData;
+
+	// 1. 셀 배경: 같은 상태가 이어지는 가로 구간을 하나의 박스로 그립니다
+	const int32 CellLayer = LayerId;
+	for (int32 Row = 0; Row < Data.Rows; ++Row)
+	{
+		int32 RunStart = 0;
+		for (int32 Column = 1; Column <= Data.Columns; ++Column)
+		{
+			const EInv_GridSlotState RunState = Data.CellStates[RunStart + Row * Data.Columns];
+			if (Column < Data.Columns && Data.CellStates[Column + Row * Data.Columns] == RunState) continue;
+
+			Data.CellBrushes.PaintRun(AllottedGeometry, OutDrawElements, CellLayer, Data.TileSize, RunState, Row, RunStart, Column - RunStart);
+			RunStart = Column;
+		}
+	}
+
+	// 2. 아이템 아이콘: 회전한 아이템은 원래 크기의 아이콘을 영역 중심 기준으로 90도 회전합니다
+	const int32 IconLayer = CellLayer + 1;
+	for (const auto& [Index, Item] : Data.Items)
+	{
+		if (!Item.Brush) continue;
+
+		const FVector2D IconSize = Item.bRotated ? FVector2D(Item.Size.Y, Item.Size.X) : Item.Size;
+		const FVector2D IconPosition = Item.Position + (Item.Size - IconSize) * 0.5;
+		const FSlateRenderTransform Rotation(FQuat2D(Item.bRotated ? UE_HALF_PI : 0.f));
+
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			IconLayer,
+			AllottedGeometry.ToPaintGeometry(IconSize, FSlateLayoutTransform(IconPosition), Rotation, FVector2D(0.5, 0.5)),
+			Item.Brush);
+	}
+
+	// 3. 스택 수량: 아이템 영역의 우하단에 표시합니다
+	const int32 TextLayer = IconLayer + 1;
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	for (const auto& [Index, Item] : Data.Items)
+	{
+		if (Item.StackCount <= 0) continue;
+
+		const FString StackText = FString::FromInt(Item.StackCount);
+		const FVector2D TextSize = FontMeasure->Measure(StackText, Data.StackCountFont);
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			TextLayer,
+			AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(Item.Position + Item.Size - TextSize)),
+			StackText,
+			Data.StackCountFont);
+	}
+	return TextLayer;
+}
+
+int32 SInv_GridRenderer::GetCellIndexAt(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) const
+{
+	if (!RenderData.IsValid() || RenderData->TileSize <= 0.f) return INDEX_NONE;
+
+	const FVector2D LocalPosition = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+	const int32 Column = FMath::FloorToInt(LocalPosition.X / RenderData->TileSize);
+	const int32 Row = FMath::FloorToInt(LocalPosition.Y / RenderData->TileSize);
+	if (Column < 0 || Column >= RenderData->Columns || Row < 0 || Row >= RenderData->Rows) return INDEX_NONE;
+	return Column + Row * RenderData->Columns;
+}
+
+FReply SInv_GridRenderer::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	const int32 CellIndex = GetCellIndexAt(MyGeometry, MouseEvent);
+	if (CellIndex == INDEX_NONE) return FReply::Unhandled();
+
+	OnCellClicked.ExecuteIfBound(CellIndex, MouseEvent);
+	return FReply::Handled();
+}
+
+FReply SInv_GridRenderer::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	// 셀이 바뀔 때만 알립니다 (셀 안에서의 움직임은 무시)
+	const int32 CellIndex = GetCellIndexAt(MyGeometry, MouseEvent);
+	if (CellIndex != HoveredCellIndex)
+	{
+		const int32 PreviousCellIndex = HoveredCellIndex;
+		HoveredCellIndex = CellIndex;
+		OnHoveredCellChanged.ExecuteIfBound(PreviousCellIndex, CellIndex, MouseEvent);
+	}
+	return FReply::Unhandled();
+}
+
+void SInv_GridRenderer::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+	SLeafWidget::OnMouseLeave(MouseEvent);
+
+	if (HoveredCellIndex == INDEX_NONE) return;
+
+	const int32 PreviousCellIndex = HoveredCellIndex;
+	HoveredCellIndex = INDEX_NONE;
+	OnHoveredCellChanged.ExecuteIfBound(PreviousCellIndex, INDEX_NONE, MouseEvent);
+}
@@ -0,0 +1,58 @@
+#include "Widgets/ItemDescription/Inv_ItemDescriptionPayload.h"
+
+#include "Engine/Texture2D.h"
+#include "Widgets/Composite/Inv_CompositeBase.h"
+#include "Widgets/Composite/Inv_Leaf_Image.h"
+#include "Widgets/Composite/Inv_Leaf_LabeledValue.h"
+#include "Widgets/Composite/Inv_Leaf_Text.h"
+
+void FInv_ItemDescriptionPayload::ApplyTo(UInv_CompositeBase* Composite) const
+{
+	if (!IsValid(Composite)) return;
+
+	Composite->BeginAssimilation();
+	for (const FInv_DescriptionEntry& Entry : Entries)
+	{
+		// 태그가 일치하는 리프에만 항목을 적용합니다
+		Composite->ForEachLeafWithTag(Entry.Tag, [&Entry](UInv_CompositeBase* Leaf)
+		{
+			Leaf->Expand();
+
+			switch (Entry.Type)
+			{
+			case EInv_DescriptionEntryType::Image:
+				if (UInv_Leaf_Image* Image = Cast<UInv_Leaf_Image>(Leaf))
+				{
+					Image->SetImage(Entry.Icon);
+					Image->SetBoxSize(Entry.IconDimensions);
+					Image->SetImageSize(Entry.IconDimensions);
+				}
+				break;
+			case EInv_DescriptionEntryType::Text:
+				if (const UInv_Leaf_Text* LeafText = Cast<UInv_Leaf_Text>(Leaf))
+				{
+					LeafText->SetText(Entry.Text);
+				}
+				break;
+			case EInv_DescriptionEntryType::LabeledValue:
+				if (const UInv_Leaf_LabeledValue* LabeledValue = Cast<UInv_Leaf_LabeledValue>(Leaf))
+				{
+					LabeledValue->SetText_Label(Entry.Text, Entry.bCollapseLabel);
+					LabeledValue->SetText_Value(Entry.Value, Entry.bCollapseValue);
+				}
+				break;
+			default:
+				break;
+			}
+		});
+	}
+	Composite->EndAssimilation();
+}
+
+void FInv_ItemDescriptionPayload::Reset(const uint32 InManifestRevision, const FString& InLocale)
+{
+	Entries.Reset();
+	ManifestRevision = InManifestRevision;
+	Locale = InLocale;
+	bBuilt = true;
+}
@@ -7,6 +7,7 @@
 #include "Components/SizeBox.h"
 #include "Components/Slider.h"
 #include "Components/TextBlock.h"
+#include "Widgets/Pool/Inv_WidgetPoolSubsystem.h"
 
 void UInv_ItemPopUp::NativeOnInitialized()
 {
@@ -23,7 +24,26 @@ void UInv_ItemPopUp::NativeOnMouseLeave(const FPointerEvent& InMouseEvent)
 {
     Super::NativeOnMouseLeave(InMouseEvent);
     // 마우스가 팝업 영역을 벗어나면 팝업을 화면에서 제거
-    RemoveFromParent();
+    Dismiss();
+}
+
+void UInv_ItemPopUp::OnReleasedToPool_Implementation()
+{
+    // 이전 아이템에 맞춰 바인딩하고 숨겼던 항목들을 되돌립니다
+    OnSplit.Unbind();
+    OnDrop.Unbind();
+    OnConsume.Unbind();
+    Button_Split->SetVisibility(ESlateVisibility::Visible);
+    Slider_Split->SetVisibility(ESlateVisibility::Visible);
+    Text_SplitAmount->SetVisibility(ESlateVisibility::Visible);
+    Button_Consume->SetVisibility(ESlateVisibility::Visible);
+    GridIndex = INDEX_NONE;
+}
+
+void UInv_ItemPopUp::Dismiss()
+{
+    // 화면에서 제거하고 다음 우클릭에서 재사용하도록 풀에 반환
+    UInv_WidgetPoolSubsystem::ReleaseWidget(this);
 }
 
 int32 UInv_ItemPopUp::GetSplitAmount() const
@@ -68,7 +88,7 @@ void UInv_ItemPopUp::SplitButtonClicked()
     // 분리 델리게이트를 실행하고 성공 시 팝업 제거
     if (OnSplit.ExecuteIfBound(GetSplitAmount(), GridIndex))
     {
-        RemoveFromParent();
+        Dismiss();
     }
 }
 
@@ -77,7 +97,7 @@ void UInv_ItemPopUp::DropButtonClicked()
     // 버리기 델리게이트를 실행하고 성공 시 팝업 제거
     if (OnDrop.ExecuteIfBound(GridIndex))
     {
-        RemoveFromParent();
+        Dismiss();
     }
 }
 
@@ -86,7 +106,7 @@ void UInv_ItemPopUp::ConsumeButtonClicked()
     // 사용 델리게이트를 실행하고 성공 시 팝업 제거
     if (OnConsume.ExecuteIfBound(GridIndex))
     {
-        RemoveFromParent();
+        Dismiss();
     }
 }
 
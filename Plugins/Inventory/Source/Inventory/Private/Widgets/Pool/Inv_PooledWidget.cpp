@@ -0,0 +1,7 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Pool/Inv_PooledWidget.h"
+
+
+// Add default functionality here for any IInv_PooledWidget functions that are not pure virtual.
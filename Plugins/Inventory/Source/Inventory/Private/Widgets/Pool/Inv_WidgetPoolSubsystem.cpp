@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Pool/Inv_WidgetPoolSubsystem.h"
+
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "Widgets/Pool/Inv_PooledWidget.h"
+
+void UInv_WidgetPoolSubsystem::Deinitialize()
+{
+	Empty();
+	Super::Deinitialize();
+}
+
+UInv_WidgetPoolSubsystem* UInv_WidgetPoolSubsystem::Get(const APlayerController* PlayerController)
+{
+	if (!IsValid(PlayerController)) return nullptr;
+
+	// 위젯은 로컬 플레이어에게만 있으므로 풀도 로컬 플레이어 서브시스템입니다
+	const ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+	if (!IsValid(LocalPlayer)) return nullptr;
+	return LocalPlayer->GetSubsystem<UInv_WidgetPoolSubsystem>();
+}
+
+void UInv_WidgetPoolSubsystem::ReleaseWidget(UUserWidget* Widget)
+{
+	if (!IsValid(Widget)) return;
+
+	if (UInv_WidgetPoolSubsystem* WidgetPool = Get(Widget->GetOwningPlayer()))
+	{
+		WidgetPool->Release(Widget);
+		return;
+	}
+	Widget->RemoveFromParent();
+}
+
+UUserWidget* UInv_WidgetPoolSubsystem::Acquire(APlayerController* OwningPlayer, TSubclassOf<UUserWidget> WidgetClass)
+{
+	if (!IsValid(WidgetClass)) return nullptr;
+
+	if (FInv_PooledWidgetList* PooledWidgets = Pools.Find(WidgetClass.Get()))
+	{
+		while (!PooledWidgets->Widgets.IsEmpty())
+		{
+			UUserWidget* Widget = PooledWidgets->Widgets.Pop(EAllowShrinking::No);
+
+			// 레벨 이동 등으로 소유 플레이어가 바뀐 위젯은 버립니다
+			if (IsValid(Widget) && Widget->GetOwningPlayer() == OwningPlayer)
+			{
+				return Widget;
+			}
+		}
+	}
+	return CreateWidget<UUserWidget>(OwningPlayer, WidgetClass);
+}
+
+void UInv_WidgetPoolSubsystem::Release(UUserWidget* Widget)
+{
+	if (!IsValid(Widget)) return;
+
+	// 화면에서 제거한 뒤 다음 사용을 위해 상태를 초기화합니다
+	Widget->RemoveFromParent();
+	if (Widget->Implements<UInv_PooledWidget>())
+	{
+		IInv_PooledWidget::Execute_OnReleasedToPool(Widget);
+	}
+
+	FInv_PooledWidgetList& PooledWidgets = Pools.FindOrAdd(Widget->GetClass());
+	if (PooledWidgets.Widgets.Num() >= MaxPooledWidgetsPerClass || PooledWidgets.Widgets.Contains(Widget)) return;
+	PooledWidgets.Widgets.Add(Widget);
+}
+
+void UInv_WidgetPoolSubsystem::Empty()
+{
+	Pools.Empty();
+}
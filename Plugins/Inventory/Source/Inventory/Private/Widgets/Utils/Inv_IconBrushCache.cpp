@@ -0,0 +1,132 @@
+#include "Widgets/Utils/Inv_IconBrushCache.h"
+
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+#include "UObject/UObjectGlobals.h"
+#include "Widgets/Utils/Inv_IconStreamingSubsystem.h"
+
+FInv_IconBrushCache::~FInv_IconBrushCache()
+{
+	// 로드 완료 콜백이 사라진 캐시를 호출하지 않도록 취소합니다
+	CancelPendingLoads();
+}
+
+const FSlateBrush& FInv_IconBrushCache::FindOrAdd(const TSoftObjectPtr<UTexture2D>& Icon, const FIntPoint& GridSize, const float Padding, const float TileSize, const float Scale)
+{
+	const FKey Key{Icon.ToSoftObjectPath(), GridSize, Padding, TileSize, Scale};
+	if (FEntry* Found = Entries.Find(Key))
+	{
+		Found->bUsed = true;
+		return *Found->Brush;
+	}
+
+	// 처음 요청된 조합이면 브러시를 만들어 캐시합니다
+	UTexture2D* LoadedIcon = Icon.Get();
+	const bool bIconReady = IsValid(LoadedIcon) || Icon.IsNull();
+	TUniquePtr<FSlateBrush> Brush = MakeUnique<FSlateBrush>(bIconReady ? FSlateBrush() : PlaceholderBrush);
+	Brush->ImageSize = FVector2D(GridSize) * (TileSize - Padding * 2) * Scale;
+	if (bIconReady)
+	{
+		Brush->SetResourceObject(LoadedIcon);
+		Brush->DrawAs = ESlateBrushDrawType::Image;
+	}
+	FEntry& Entry = Entries.Add(Key, FEntry{LoadedIcon, MoveTemp(Brush)});
+
+	// 아직 로드되지 않은 아이콘은 자리 표시 브러시로 두고 비동기로 로드합니다
+	// 로드가 요청 중에 바로 끝나 콜백이 먼저 호출될 수 있으므로 자리를 먼저 만들고, 콜백이 지우지 않았을 때만 핸들을 보관합니다
+	if (!bIconReady && !PendingLoads.Contains(Key.Icon))
+	{
+		const FSoftObjectPath Path = Key.Icon;
+		PendingLoads.Add(Path);
+		TSharedPtr<FStreamableHandle> Handle = UInv_IconStreamingSubsystem::RequestIcon(Icon, FStreamableDelegate::CreateLambda([this, Path]()
+		{
+			HandleIconLoaded(Path);
+		}));
+		if (TSharedPtr<FStreamableHandle>* Pending = PendingLoads.Find(Path))
+		{
+			*Pending = MoveTemp(Handle);
+		}
+	}
+	return *Entry.Brush;
+}
+
+void FInv_IconBrushCache::HandleIconLoaded(const FSoftObjectPath Path)
+{
+	// 핸들은 브러시가 아이콘을 참조하게 된 뒤 놓습니다 (완료 콜백 안에서 핸들을 지우지 않도록 맵에서만 뺌)
+	TSharedPtr<FStreamableHandle> Handle;
+	PendingLoads.RemoveAndCopyValue(Path, Handle);
+
+	UTexture2D* LoadedIcon = Cast<UTexture2D>(Path.ResolveObject());
+	if (!IsValid(LoadedIcon)) return;
+
+	for (auto& [Key, Entry] : Entries)
+	{
+		if (Key.Icon != Path || IsValid(Entry.Icon)) continue;
+
+		// 자리 표시 브러시를 같은 크기의 아이콘 브러시로 바꿉니다 (포인터로 참조하는 곳은 그대로 유효)
+		const FVector2D ImageSize = Entry.Brush->ImageSize;
+		*Entry.Brush = FSlateBrush();
+		Entry.Brush->SetResourceObject(LoadedIcon);
+		Entry.Brush->DrawAs = ESlateBrushDrawType::Image;
+		Entry.Brush->ImageSize = ImageSize;
+		Entry.Icon = LoadedIcon;
+	}
+	OnIconLoaded.ExecuteIfBound();
+}
+
+void FInv_IconBrushCache::Reset()
+{
+	CancelPendingLoads();
+	Entries.Reset();
+}
+
+void FInv_IconBrushCache::ResetUsage()
+{
+	for (auto& [Key, Entry] : Entries)
+	{
+		Entry.bUsed = false;
+	}
+}
+
+void FInv_IconBrushCache::RemoveUnused()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.bUsed) It.RemoveCurrent();
+	}
+
+	// 요청하는 브러시가 남아있지 않은 아이콘은 로드를 취소합니다
+	for (auto It = PendingLoads.CreateIterator(); It; ++It)
+	{
+		bool bStillRequested = false;
+		for (const auto& [Key, Entry] : Entries)
+		{
+			if (Key.Icon == It->Key)
+			{
+				bStillRequested = true;
+				break;
+			}
+		}
+		if (bStillRequested) continue;
+
+		if (It->Value.IsValid()) It->Value->CancelHandle();
+		It.RemoveCurrent();
+	}
+}
+
+void FInv_IconBrushCache::CancelPendingLoads()
+{
+	for (const auto& [Path, Handle] : PendingLoads)
+	{
+		if (Handle.IsValid()) Handle->CancelHandle();
+	}
+	PendingLoads.Reset();
+}
+
+void FInv_IconBrushCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (auto& [Key, Entry] : Entries)
+	{
+		Collector.AddReferencedObject(Entry.Icon);
+	}
+}
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/Utils/Inv_IconStreamingSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/Texture2D.h"
+#include "GameFramework/PlayerController.h"
+#include "Items/Fragments/Inv_ItemFragment.h"
+#include "Items/Manifest/Inv_ItemManifest.h"
+
+void UInv_IconStreamingSubsystem::Deinitialize()
+{
+	for (const auto& [Path, Handle] : PrefetchHandles)
+	{
+		if (Handle.IsValid()) Handle->ReleaseHandle();
+	}
+	PrefetchHandles.Reset();
+	Super::Deinitialize();
+}
+
+UInv_IconStreamingSubsystem* UInv_IconStreamingSubsystem::Get(const APlayerController* PlayerController)
+{
+	if (!IsValid(PlayerController)) return nullptr;
+
+	const ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+	if (!IsValid(LocalPlayer)) return nullptr;
+	return LocalPlayer->GetSubsystem<UInv_IconStreamingSubsystem>();
+}
+
+TSharedPtr<FStreamableHandle> UInv_IconStreamingSubsystem::RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon, FStreamableDelegate OnLoaded)
+{
+	if (Icon.IsNull()) return nullptr;
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(Icon.ToSoftObjectPath(), MoveTemp(OnLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UInv_IconStreamingSubsystem::PrefetchItemIcon(const APlayerController* PlayerController, const FInv_ItemManifest& Manifest)
+{
+	const FInv_ImageFragment* ImageFragment = Manifest.GetFragmentOfType<FInv_ImageFragment>();
+	if (!ImageFragment) return;
+
+	if (UInv_IconStreamingSubsystem* IconStreaming = Get(PlayerController))
+	{
+		IconStreaming->Prefetch(ImageFragment->GetIcon());
+	}
+}
+
+void UInv_IconStreamingSubsystem::Prefetch(const TSoftObjectPtr<UTexture2D>& Icon)
+{
+	if (Icon.IsNull()) return;
+
+	// 이미 프리페치한 아이콘은 가장 최근 위치로 옮기기만 합니다
+	const FSoftObjectPath Path = Icon.ToSoftObjectPath();
+	const int32 ExistingIndex = PrefetchHandles.IndexOfByPredicate([&Path](const TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Entry)
+	{
+		return Entry.Key == Path;
+	});
+	if (ExistingIndex != INDEX_NONE)
+	{
+		TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>> Entry = MoveTemp(PrefetchHandles[ExistingIndex]);
+		PrefetchHandles.RemoveAt(ExistingIndex, EAllowShrinking::No);
+		PrefetchHandles.Add(MoveTemp(Entry));
+		return;
+	}
+
+	// 가장 오래된 프리페치를 놓습니다 (화면에서 쓰고 있는 아이콘은 브러시가 계속 참조함)
+	if (PrefetchHandles.Num() >= MaxPrefetchedIcons)
+	{
+		if (PrefetchHandles[0].Value.IsValid()) PrefetchHandles[0].Value->ReleaseHandle();
+		PrefetchHandles.RemoveAt(0, EAllowShrinking::No);
+	}
+	PrefetchHandles.Emplace(Path, RequestIcon(Icon));
+}
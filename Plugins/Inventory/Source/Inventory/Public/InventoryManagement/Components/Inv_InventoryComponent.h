@@ -5,10 +5,12 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "InventoryManagement/FastArray/Inv_FastArray.h"
+#include "InventoryManagement/Grid/Inv_GridModel.h"
 #include "Inv_InventoryComponent.generated.h"
 
 
 struct FInv_SlotAvailabilityResult;
+struct FInv_TidyResult;
 class UInv_ItemComponent;
 class UInv_InventoryBase;
 
@@ -25,6 +27,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FItemEquipStatusChanged, UInv_Invent
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInventoryMenuToggled, bool, bOpen);
 
+/** 그리드 정리 등으로 한 카테고리 그리드의 배치가 한꺼번에 바뀌었을 때 호출되는 델리게이트 */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGridRearranged, EInv_ItemCategory, Category);
+
 /**
  * 인벤토리 관리를 담당하는 액터 컴포넌트
  * 서버 권한 기반의 인벤토리 연산을 처리하며, Fast Array를 통해 인벤토리 상태를 복제합니다
@@ -54,20 +59,19 @@ public:
 
 	/**
 	 * 서버 RPC: 새로운 아이템을 인벤토리에 추가합니다
+	 * 배치 위치와 수량은 서버의 그리드 모델에서 다시 계산됩니다
 	 * @param ItemComponent 추가할 아이템 컴포넌트
-	 * @param StackCount 추가할 스택 수량
 	 */
 	UFUNCTION(Server, Reliable)
-	void Server_AddNewItem(UInv_ItemComponent* ItemComponent, int32 StackCount, int32 Remainder);
+	void Server_AddNewItem(UInv_ItemComponent* ItemComponent);
 
 	/**
 	 * 서버 RPC: 기존 아이템에 스택을 추가합니다
+	 * 채울 수 있는 수량은 서버의 그리드 모델에서 다시 계산됩니다
 	 * @param ItemComponent 스택을 추가할 아이템 컴포넌트
-	 * @param StackCount 추가할 스택 수량
-	 * @param Remainder 남은 수량 (추가할 수 없는 수량)
 	 */
 	UFUNCTION(Server, Reliable)
-	void Server_AddStacksToItem(UInv_ItemComponent* ItemComponent, int32 StackCount, int32 Remainder);
+	void Server_AddStacksToItem(UInv_ItemComponent* ItemComponent);
 
 	/**
 	 * 서버 RPC: 인벤토리에서 아이템을 드롭합니다
@@ -113,6 +117,110 @@ public:
 	 */
 	void SpawnDroppedItem(UInv_InventoryItem* Item, int32 StackCount);
 
+	/**
+	 * 아이템 컴포넌트를 위한 공간이 있는지 그리드 모델에서 확인합니다
+	 * 인벤토리 위젯 없이도 동작하므로 데디케이티드 서버에서도 사용할 수 있습니다
+	 * @param ItemComponent 확인할 아이템 컴포넌트
+	 * @return 슬롯 사용 가능 여부 결과
+	 */
+	FInv_SlotAvailabilityResult HasRoomForItem(const UInv_ItemComponent* ItemComponent) const;
+
+	/**
+	 * 여러 아이템(상자 내용물, 퀘스트 보상 등)의 배치를 한 번에 계획합니다
+	 * 카테고리별 그리드 모델마다 한 번의 계획으로 처리하며, 같은 카테고리의 아이템은 서로가 차지할 공간을 고려합니다
+	 * @param Manifests 배치할 아이템 매니페스트들
+	 * @return 입력 순서대로의 아이템별 결과와 남은 수량
+	 */
+	FInv_PlacementPlan PlanPlacement(TArrayView<const FInv_ItemManifest*> Manifests) const;
+
+	/**
+	 * 카테고리에 해당하는 그리드 모델을 가져옵니다
+	 * 그리드 위젯은 이 모델을 읽어 화면을 갱신합니다
+	 * @param Category 아이템 카테고리
+	 * @return 그리드 모델 (해당 카테고리가 없으면 비어있는 모델)
+	 */
+	const FInv_GridModel& GetGridModel(const EInv_ItemCategory Category) const;
+
+	/**
+	 * 복제로 추가된 아이템을 엔트리에 기록된 서버의 위치 그대로 로컬 그리드 모델에 배치합니다
+	 * 예측한 다른 배치가 자리를 차지하고 있으면 카테고리 전체를 엔트리대로 다시 배치합니다
+	 * @param Item 추가된 인벤토리 아이템
+	 * @param GridStacks 엔트리에 복제된 서버 그리드 모델의 스택들
+	 */
+	void AddReplicatedItemToGrid(UInv_InventoryItem* Item, const TArray<FInv_GridStack>& GridStacks);
+
+	/**
+	 * 로컬 그리드 모델의 배치를 엔트리와 비교할 아이템으로 표시합니다 (클라이언트에서만)
+	 * 복제로 엔트리가 바뀌거나 제거된 아이템, 로컬에서 예측 편집한 아이템이 표시됩니다
+	 * @param Item 비교할 인벤토리 아이템
+	 */
+	void MarkGridItemForReconcile(UInv_InventoryItem* Item);
+
+	/**
+	 * 표시된 아이템의 로컬 그리드 배치를 엔트리에 복제된 서버의 배치로 맞춥니다 (클라이언트에서만)
+	 * 보낸 그리드 편집을 서버가 모두 처리했을 때만 맞추며, 그 전에는 다음 복제까지 기다립니다
+	 */
+	void ReconcileGridItems();
+
+	/**
+	 * 클라이언트에서 아이템의 매니페스트가 복원되었을 때 호출됩니다
+	 * 매니페스트보다 먼저 복제되어 보류된 인벤토리 엔트리를 추가된 것으로 처리합니다
+	 * @param Item 매니페스트가 복원된 인벤토리 아이템
+	 */
+	void HandleItemManifestReady(UInv_InventoryItem* Item);
+
+	/**
+	 * 클라이언트의 정의 레지스트리에 없는 아이템 타입의 정의를 서버에 요청합니다
+	 * 같은 타입의 요청은 한 번만 보내며, 정의를 받으면 기다리던 아이템들의 매니페스트를 복원합니다
+	 * @param Item 정의를 기다리는 인벤토리 아이템
+	 */
+	void RequestItemDefinition(UInv_InventoryItem* Item);
+
+	/**
+	 * 아이템을 첫 번째로 맞는 위치에 배치하거나 같은 타입의 스택에 채웁니다
+	 * 클라이언트에서 호출하면 서버 모델에도 같은 연산을 요청합니다
+	 * @param Item 배치할 인벤토리 아이템
+	 * @param StackCount 배치할 스택 수량
+	 * @return 모델에 적용된 슬롯 사용 가능 여부 결과
+	 */
+	FInv_SlotAvailabilityResult AddItemToGrid(UInv_InventoryItem* Item, const int32 StackCount);
+
+	/**
+	 * 아이템을 그리드의 지정된 인덱스에 배치합니다
+	 * 클라이언트에서 호출하면 서버 모델에도 같은 연산을 요청합니다
+	 * @param Item 배치할 인벤토리 아이템
+	 * @param Index 좌상단 인덱스
+	 * @param StackCount 스택 수량
+	 * @param bRotated 90도 회전해 배치할지 여부
+	 * @return 모델에 배치되었으면 true (영역이 비어있지 않거나 그리드를 벗어나면 false)
+	 */
+	bool PlaceItemInGrid(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount, const bool bRotated = false);
+
+	/**
+	 * 지정된 인덱스의 아이템을 그리드에서 제거합니다
+	 * 클라이언트에서 호출하면 서버 모델에도 같은 연산을 요청합니다
+	 * @param Item 제거할 인벤토리 아이템
+	 * @param Index 아이템이 차지하는 셀의 인덱스
+	 */
+	void RemoveItemFromGrid(UInv_InventoryItem* Item, const int32 Index);
+
+	/**
+	 * 지정된 인덱스에 있는 스택의 수량을 설정합니다
+	 * 클라이언트에서 호출하면 서버 모델에도 같은 연산을 요청합니다
+	 * @param Item 대상 인벤토리 아이템
+	 * @param Index 아이템이 차지하는 셀의 인덱스
+	 * @param StackCount 설정할 스택 수량
+	 */
+	void SetGridStackCount(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount);
+
+	/**
+	 * 모든 카테고리 그리드를 정리합니다
+	 * 카테고리별 정리 계산은 워커 스레드에서 동시에 실행되며, 모두 끝나면 게임 스레드에서 한꺼번에 적용됩니다
+	 * 계산하는 동안 그리드가 바뀐 카테고리는 적용하지 않습니다
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void TidyInventory();
+
 	UInv_InventoryBase* GetInventoryMenu() const { return InventoryMenu; }
 	
 	bool IsMenuOpen() const { return bInventoryMenuOpen; }
@@ -132,6 +240,9 @@ public:
 	FItemEquipStatusChanged OnItemEquipped;
 	FItemEquipStatusChanged OnItemUnequipped;
 	FInventoryMenuToggled OnInventoryMenuToggled;
+
+	/** 한 카테고리 그리드의 배치가 한꺼번에 바뀌었을 때 호출되는 델리게이트 */
+	FGridRearranged OnGridRearranged;
 	
 protected:
 	/**
@@ -143,10 +254,125 @@ protected:
 private:
 	/**
 	 * 인벤토리를 구성합니다
-	 * 인벤토리 메뉴 위젯을 생성하고 초기화합니다
+	 * 그리드 모델을 초기화하고, 로컬 컨트롤러라면 인벤토리 메뉴 위젯을 생성합니다
 	 */
 	void ConstructInventory();
 
+	/**
+	 * 카테고리별 그리드 모델을 GridSizes 설정에 따라 초기화합니다
+	 */
+	void ConstructGridModels();
+
+	/**
+	 * 카테고리에 해당하는 수정 가능한 그리드 모델을 찾습니다
+	 * @param Category 아이템 카테고리
+	 * @return 그리드 모델, 없으면 nullptr
+	 */
+	FInv_GridModel* FindGridModel(const EInv_ItemCategory Category);
+
+	/**
+	 * 아이템이 이 인벤토리에 속해 있는지 확인합니다
+	 * 클라이언트가 요청한 그리드 연산을 검증할 때 사용됩니다
+	 * @param Item 확인할 인벤토리 아이템
+	 * @return 인벤토리 리스트에 있으면 true
+	 */
+	bool OwnsItem(const UInv_InventoryItem* Item) const;
+
+	/**
+	 * 엔트리의 전체 수량 중 서버 그리드 모델에 놓이지 않은(호버로 들고 있는) 수량을 반환합니다
+	 * 클라이언트의 그리드 편집이 엔트리의 전체 수량을 바꾸지 않는지 검증할 때 사용됩니다
+	 * @param Item 확인할 인벤토리 아이템
+	 * @return 스택 가능 아이템은 그리드 밖의 수량, 스택 불가능 아이템은 그리드에 없으면 1
+	 */
+	int32 GetUnplacedStackCount(const UInv_InventoryItem* Item) const;
+
+	/**
+	 * 요청한 수량을 그리드 밖의 수량에서 가져올 수 있는지 확인합니다
+	 * @param Item 확인할 인벤토리 아이템
+	 * @param StackCount 그리드에 놓거나 드롭하려는 수량 (스택 불가능 아이템은 무시됨)
+	 * @return 가져올 수 있으면 true
+	 */
+	bool IsWithinUnplacedStackCount(const UInv_InventoryItem* Item, int32 StackCount) const;
+
+	/**
+	 * 아이템의 엔트리와 서버 그리드 모델의 스택을 함께 제거합니다 (서버에서만)
+	 * @param Item 제거할 인벤토리 아이템
+	 */
+	void RemoveItemFromInventory(UInv_InventoryItem* Item);
+
+	/**
+	 * 스택 추가 결과를 그리드 모델에 적용하고 위젯에 알립니다
+	 * @param Result 스택 추가 결과 (Item이 설정되어 있어야 함)
+	 */
+	void ApplyStacksToGrid(const FInv_SlotAvailabilityResult& Result);
+
+	/**
+	 * 서버 그리드 모델에 배치된 아이템의 스택들을 인벤토리 엔트리에 기록합니다 (서버에서만)
+	 * @param Item 배치가 바뀐 인벤토리 아이템
+	 */
+	void UpdateEntryGridStacks(UInv_InventoryItem* Item);
+
+	/**
+	 * 로컬 그리드 모델의 한 카테고리를 비우고 엔트리에 기록된 서버의 배치대로 다시 채웁니다 (클라이언트에서만)
+	 * @param Category 다시 채울 카테고리
+	 */
+	void RebuildGridModel(const EInv_ItemCategory Category);
+
+	/**
+	 * 서버에 보낸 그리드 편집을 기록합니다 (클라이언트에서만)
+	 * 서버가 이 편집까지 처리했다고 알려오면 편집한 아이템의 예측 배치를 엔트리와 비교합니다
+	 * @param Item 편집한 인벤토리 아이템
+	 */
+	void RecordGridEdit(UInv_InventoryItem* Item);
+
+	/** 서버가 처리한 그리드 편집 수가 복제되면 기다리던 배치 비교를 실행합니다 */
+	UFUNCTION()
+	void OnRep_AppliedGridEdits();
+
+	/** 서버 RPC: 클라이언트 모델에서 실행된 AddItemToGrid를 서버 모델에 반영합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_AddItemToGrid(UInv_InventoryItem* Item, int32 StackCount);
+
+	/** 서버 RPC: 클라이언트 모델에서 실행된 PlaceItemInGrid를 서버 모델에 반영합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_PlaceItemInGrid(UInv_InventoryItem* Item, int32 Index, int32 StackCount, bool bRotated);
+
+	/** 서버 RPC: 클라이언트 모델에서 실행된 RemoveItemFromGrid를 서버 모델에 반영합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_RemoveItemFromGrid(UInv_InventoryItem* Item, int32 Index);
+
+	/** 서버 RPC: 클라이언트 모델에서 실행된 SetGridStackCount를 서버 모델에 반영합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_SetGridStackCount(UInv_InventoryItem* Item, int32 Index, int32 StackCount);
+
+	/** 서버 RPC: 아이템 타입의 정의 매니페스트를 요청합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_RequestItemDefinition(FGameplayTag ItemType);
+
+	/** 클라이언트 RPC: 요청한 정의 매니페스트를 받아 레지스트리에 등록합니다 (매니페스트의 NetSerialize로 압축됨) */
+	UFUNCTION(Client, Reliable)
+	void Client_ReceiveItemDefinition(const FInv_ItemManifest& Definition);
+
+	/**
+	 * 정리 계산 결과를 그리드 모델에 적용하고 클라이언트라면 서버에 전달합니다 (게임 스레드)
+	 * 서버에서 적용한 결과는 엔트리의 그리드 배치로 클라이언트에 복제됩니다
+	 * @param Results 카테고리별 정리 결과
+	 */
+	void ApplyTidyResults(const TArray<FInv_TidyResult>& Results);
+
+	/**
+	 * 여러 카테고리의 이동 목록을 한꺼번에 적용합니다
+	 * 하나라도 적용할 수 없으면 이미 적용한 카테고리도 되돌립니다
+	 * 서버에서는 옮겨진 아이템의 배치를 엔트리에 기록하고, 클라이언트에서는 엔트리와 비교할 아이템으로 표시합니다
+	 * @param MoveSets 카테고리별 이동 목록
+	 * @return 모두 적용되었으면 true
+	 */
+	bool ApplyGridMoveSets(const TArray<FInv_GridMoveSet>& MoveSets);
+
+	/** 서버 RPC: 클라이언트에서 적용한 정리 결과를 하나의 변경 묶음으로 서버 모델에 반영합니다 */
+	UFUNCTION(Server, Reliable)
+	void Server_ApplyGridMoveSets(const TArray<FInv_GridMoveSet>& MoveSets);
+
 	/**
 	 * 인벤토리 메뉴를 엽니다
 	 */
@@ -164,6 +390,45 @@ private:
 	UPROPERTY(Replicated)
 	FInv_InventoryFastArray InventoryList;
 
+	/**
+	 * 카테고리별 그리드 모델
+	 * 서버와 로컬 클라이언트 모두에서 유지되며, 배치 검사와 스택 연산의 기준이 됩니다
+	 */
+	TMap<EInv_ItemCategory, FInv_GridModel> GridModels;
+
+	/**
+	 * 카테고리별 그리드 크기 (X = 열 수, Y = 행 수)
+	 * 서버에는 그리드 위젯이 없으므로 그리드 크기는 컴포넌트에서 정의하며, 그리드 위젯은 이 값을 따릅니다
+	 */
+	UPROPERTY(EditAnywhere, Category = "Inventory")
+	TMap<EInv_ItemCategory, FIntPoint> GridSizes;
+
+	/** 그리드 정리 계산에 사용할 수 있는 최대 시간 (초, 워커 스레드에서 실행됨) */
+	UPROPERTY(EditAnywhere, Category = "Inventory")
+	float TidyTimeBudget{0.25f};
+
+	/** 서버에 정의를 요청한 아이템 타입별로 정의를 기다리는 아이템들 (클라이언트에서만) */
+	TMap<FGameplayTag, TArray<TWeakObjectPtr<UInv_InventoryItem>>> ItemsAwaitingDefinition;
+
+	/** 소유 클라이언트에 정의를 보낸 아이템 타입들 (서버에서만, 같은 타입의 반복 요청은 무시) */
+	TSet<FGameplayTag> SentItemDefinitions;
+
+	/**
+	 * 서버가 처리한 클라이언트의 그리드 편집 RPC 수 (거부한 편집도 포함, 소유 클라이언트에만 복제)
+	 * SentGridEdits와 같아지면 엔트리의 그리드 배치가 클라이언트의 모든 편집을 반영한 상태입니다
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_AppliedGridEdits)
+	int32 AppliedGridEdits{0};
+
+	/** 클라이언트가 서버에 보낸 그리드 편집 RPC 수 */
+	int32 SentGridEdits{0};
+
+	/** 로컬 그리드 배치를 엔트리와 비교할 아이템들 (클라이언트에서만) */
+	TSet<TWeakObjectPtr<UInv_InventoryItem>> GridItemsToReconcile;
+
+	/** 그리드 정리 계산이 진행 중인지 여부 */
+	bool bTidyInProgress{false};
+
 	/** 인벤토리 메뉴 위젯 인스턴스 */
 	UPROPERTY()
 	TObjectPtr<UInv_InventoryBase> InventoryMenu;
@@ -1,10 +1,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "Types/Inv_GridTypes.h"
 #include "Inv_FastArray.generated.h"
 
-struct FGameplayTag;
 class UInv_ItemComponent;
 class UInv_InventoryComponent;
 class UInv_InventoryItem;
@@ -29,12 +30,32 @@ private:
 	/** 이 엔트리가 나타내는 인벤토리 아이템 */
 	UPROPERTY()
 	TObjectPtr<UInv_InventoryItem> Item;
+
+	/**
+	 * 서버 그리드 모델에 배치된 아이템의 스택들 (좌상단 인덱스 순서)
+	 * 클라이언트는 배치 알고리즘을 다시 실행하지 않고 이 위치에 그대로 배치하며, 예측한 배치가 다르면 이 값으로 맞춥니다
+	 * 호버 아이템처럼 그리드에서 들려 있는 동안은 비어있습니다
+	 */
+	UPROPERTY()
+	TArray<FInv_GridStack> GridStacks;
+
+	/**
+	 * 아이템의 전체 스택 수량 (스택 불가능 아이템은 0)
+	 * 아이템 객체의 속성 대신 엔트리로 복제해 Fast Array 델타에 함께 실리며, 클라이언트는 받은 값을 아이템에 반영합니다
+	 */
+	UPROPERTY()
+	int32 TotalStackCount{0};
 };
 
 /**
  * 인벤토리 항목을 저장하는 Fast Array 구조체
  * 멀티플레이어 환경에서 효율적인 인벤토리 복제를 위한 핵심 시스템입니다
  * 델타 직렬화를 사용하여 변경된 항목만 클라이언트에 전송하므로 네트워크 대역폭을 절약합니다
+ *
+ * 아이템별 엔트리 인덱스와 타입별 아이템 목록을 함께 유지해 아이템 조회를 상수 시간에 처리합니다
+ * 서버는 엔트리를 추가/제거할 때 인덱스를 바로 갱신하고, 클라이언트는 번들 수신이 끝난 뒤 옮겨진 엔트리의 인덱스만 고칩니다
+ * 클라이언트에서 아이템 참조가 아직 풀리지 않았거나 아이템의 매니페스트가 아직 복원되지 않은 엔트리는 인덱스에 넣지 않고,
+ * 참조가 풀려 엔트리가 바뀌거나 매니페스트가 복원될 때 추가로 처리합니다
  */
 USTRUCT(BlueprintType)
 struct FInv_InventoryFastArray : public FFastArraySerializer
@@ -72,6 +93,22 @@ public:
 	 */
 	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
 
+	/**
+	 * Fast Array의 항목이 변경된 후 호출됩니다
+	 * 엔트리의 상태를 아이템에 반영하고, 바뀐 아이템들의 그리드 배치를 번들 끝에 한 번에 맞추도록 표시합니다
+	 * 추가될 때 아이템 참조가 풀리지 않았던 엔트리는 여기서 추가된 엔트리로 처리합니다
+	 * @param ChangedIndices 변경된 항목들의 인덱스
+	 * @param FinalSize 최종 배열 크기
+	 */
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+
+	/**
+	 * 복제 번들 하나의 추가/변경/제거가 모두 처리된 후 호출됩니다
+	 * 제거로 옮겨진 엔트리의 인덱스를 최종 위치로 고친 뒤, 바뀐 엔트리의 그리드 배치를 로컬 그리드 모델에 한 번에 반영합니다
+	 * @param Parameters 수신 정보
+	 */
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
 	/**
 	 * 네트워크 델타 직렬화 함수
 	 * 변경된 항목만 직렬화하여 네트워크 효율성을 높입니다
@@ -103,6 +140,29 @@ public:
 	 */
 	void RemoveEntry(UInv_InventoryItem* InItem);
 
+	/**
+	 * 아이템 엔트리의 그리드 배치를 설정합니다 (서버에서만)
+	 * 값이 바뀐 경우에만 엔트리를 복제 대상으로 표시합니다
+	 * @param InItem 대상 인벤토리 아이템
+	 * @param GridStacks 서버 그리드 모델에 배치된 아이템의 스택들 (좌상단 인덱스 순서)
+	 */
+	void SetEntryGridStacks(UInv_InventoryItem* InItem, TArray<FInv_GridStack>&& GridStacks);
+
+	/**
+	 * 아이템 엔트리에 기록된 그리드 배치를 찾습니다
+	 * @param InItem 대상 인벤토리 아이템
+	 * @return 엔트리의 스택들, 엔트리가 없으면 nullptr
+	 */
+	const TArray<FInv_GridStack>* FindEntryGridStacks(const UInv_InventoryItem* InItem) const;
+
+	/**
+	 * 아이템 엔트리의 스택 수량을 설정하고 아이템에도 반영합니다 (서버에서만)
+	 * 값이 바뀐 경우에만 엔트리를 복제 대상으로 표시합니다
+	 * @param InItem 대상 인벤토리 아이템
+	 * @param StackCount 전체 스택 수량
+	 */
+	void SetEntryStackCount(UInv_InventoryItem* InItem, const int32 StackCount);
+
 	/**
 	 * 특정 타입의 첫 번째 아이템을 찾습니다
 	 * @param ItemType 찾을 아이템의 GameplayTag 타입
@@ -110,9 +170,55 @@ public:
 	 */
 	UInv_InventoryItem* FindFirstItemByType(const FGameplayTag& ItemType);
 
+	/**
+	 * 매니페스트가 복원된 아이템의 엔트리가 보류되어 있었다면 추가된 엔트리로 처리합니다 (클라이언트에서만)
+	 * @param InItem 매니페스트가 복원된 인벤토리 아이템
+	 */
+	void HandleItemManifestReady(UInv_InventoryItem* InItem);
+
+	/**
+	 * 아이템이 이 인벤토리의 엔트리인지 확인합니다
+	 * @param InItem 확인할 인벤토리 아이템
+	 * @return 엔트리가 있으면 true
+	 */
+	bool ContainsItem(const UInv_InventoryItem* InItem) const;
+
 private:
 	friend UInv_InventoryComponent;
 
+	/**
+	 * 아이템의 엔트리 인덱스를 찾습니다
+	 * @param InItem 찾을 인벤토리 아이템
+	 * @return 엔트리 인덱스, 없으면 INDEX_NONE
+	 */
+	int32 FindEntryIndex(const UInv_InventoryItem* InItem) const;
+
+	/**
+	 * 복제로 추가된 엔트리를 인덱스에 넣고 로컬 그리드 모델과 위젯에 알립니다 (클라이언트에서만)
+	 * 아이템 참조가 아직 풀리지 않았거나, 매니페스트가 아직 복원되지 않았거나, 이미 처리된 엔트리는 무시합니다
+	 * @param EntryIndex 추가된 엔트리의 인덱스
+	 * @return 이번 호출에서 처리되었으면 true
+	 */
+	bool HandleReplicatedAdd(const int32 EntryIndex);
+
+	/**
+	 * 엔트리를 인덱스에 추가합니다 (이미 있는 아이템이면 엔트리 인덱스만 고칩니다)
+	 * @param EntryIndex 추가할 엔트리의 인덱스
+	 */
+	void AddToIndices(const int32 EntryIndex) const;
+
+	/**
+	 * 아이템을 인덱스에서 제거합니다
+	 * @param InItem 제거할 인벤토리 아이템
+	 */
+	void RemoveFromIndices(UInv_InventoryItem* InItem) const;
+
+	/**
+	 * 인덱스에 있던 아이템들로 인덱스를 다시 만듭니다
+	 * 인덱스가 엔트리와 어긋났을 때만 사용하는 안전장치입니다
+	 */
+	void RebuildIndices() const;
+
 	/** 복제된 항목 목록, NetDeltaSerialize에서 자동으로 복제됩니다 */
 	UPROPERTY()
 	TArray<FInv_InventoryEntry> Entries;
@@ -120,6 +226,18 @@ private:
 	/** 이 Fast Array를 소유하는 컴포넌트 (복제되지 않음) */
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UActorComponent> OwnerComponent;
+
+	/** 아이템별 엔트리 인덱스 (복제되지 않으며, 아이템 참조는 Entries가 유지) */
+	mutable TMap<const UInv_InventoryItem*, int32> EntryIndexByItem;
+
+	/** 아이템 타입별 아이템 목록 (추가된 순서) */
+	mutable TMap<FGameplayTag, TArray<UInv_InventoryItem*>> ItemsByType;
+
+	/**
+	 * 수신 중인 번들의 제거로 마지막 엔트리가 옮겨 들어올 위치들 (클라이언트에서만)
+	 * 엔진은 추가/변경 콜백 뒤에 엔트리를 지우므로 PostReplicatedReceive에서 최종 위치로 인덱스를 고칩니다
+	 */
+	TArray<int32> PendingMovedPositions;
 };
 
 /**
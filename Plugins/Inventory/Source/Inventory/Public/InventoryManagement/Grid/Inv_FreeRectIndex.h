@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FInv_GridBitboard;
+
+/**
+ * 그리드의 빈 공간을 최대 빈 사각형(maximal free rectangle) 목록으로 유지하는 인덱스
+ * WxH 아이템이 들어갈 수 있는 영역은 반드시 어떤 최대 빈 사각형 안에 포함되므로,
+ * 행 우선 순서의 첫 번째 배치 위치는 크기가 충분한 사각형들의 좌상단 중 가장 작은 인덱스와 같습니다
+ * 사각형들은 좌상단 인덱스 순으로 정렬되어 있어, 더 앞선 후보가 나올 수 없는 지점에서 검색을 멈춥니다
+ * 아이템 배치와 제거 시 바뀐 영역 주변만 갱신합니다
+ */
+struct INVENTORY_API FInv_FreeRectIndex
+{
+public:
+
+	/**
+	 * 인덱스를 비어있는 그리드로 초기화합니다
+	 * @param InRows 행 수
+	 * @param InColumns 열 수
+	 */
+	void Init(const int32 InRows, const int32 InColumns);
+
+	/**
+	 * 영역이 점유되었음을 반영합니다
+	 * 영역과 겹치는 빈 사각형을 나누고, 다른 사각형에 포함되는 조각은 버립니다
+	 * @param Area 점유된 영역 (Max는 포함하지 않음)
+	 */
+	void Occupy(const FIntRect& Area);
+
+	/**
+	 * 영역이 비워졌음을 반영합니다
+	 * 비워진 영역과 겹치는 새 최대 빈 사각형을 찾아 추가하고, 그 안에 포함되는 기존 사각형은 제거합니다
+	 * @param Area 비워진 영역 (Max는 포함하지 않음)
+	 * @param Occupancy 영역이 이미 비워진 상태의 점유 비트보드
+	 */
+	void Release(const FIntRect& Area, const FInv_GridBitboard& Occupancy);
+
+	/**
+	 * 행 우선 순서로 FromIndex 이후에 아이템이 들어갈 수 있는 첫 번째 빈 위치를 찾습니다
+	 * @param Dimensions 아이템 크기
+	 * @param FromIndex 검색을 시작할 인덱스 (포함)
+	 * @return 좌상단 인덱스, 없으면 INDEX_NONE
+	 */
+	int32 FindFirstFit(const FIntPoint& Dimensions, const int32 FromIndex = 0) const;
+
+	/** 현재 유지 중인 최대 빈 사각형의 수를 가져옵니다 */
+	int32 Num() const { return FreeRects.Num(); }
+
+private:
+
+	/**
+	 * 하나의 빈 사각형 안에서 FromIndex 이후의 첫 번째 배치 위치를 계산합니다
+	 * @param FreeRect 빈 사각형
+	 * @param Dimensions 아이템 크기
+	 * @param FromIndex 검색을 시작할 인덱스 (포함)
+	 * @return 좌상단 인덱스, 없으면 INDEX_NONE
+	 */
+	int32 FindFirstFitInRect(const FIntRect& FreeRect, const FIntPoint& Dimensions, const int32 FromIndex) const;
+
+	/** 사각형들을 좌상단 인덱스 순으로 정렬합니다 */
+	void SortFreeRects();
+
+	/** 좌표를 그리드 인덱스로 변환합니다 */
+	int32 ToIndex(const FIntPoint& Point) const { return Point.X + Point.Y * Columns; }
+
+	/** 좌상단 인덱스 순으로 정렬된 최대 빈 사각형들 */
+	TArray<FIntRect> FreeRects;
+
+	/** 그리드의 행 수 */
+	int32 Rows{0};
+
+	/** 그리드의 열 수 */
+	int32 Columns{0};
+};
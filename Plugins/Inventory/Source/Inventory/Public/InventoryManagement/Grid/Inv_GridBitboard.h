@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 그리드의 셀 점유 상태를 행마다 64비트 워드 배열로 압축해 저장하는 비트보드
+ * 사각형 영역의 검사와 설정을 셀 단위가 아닌 워드 단위 AND/시프트 연산으로 처리합니다
+ * 열 수가 64 이하라면 한 행은 워드 하나이며, WxH 영역 검사는 H번의 워드 비교로 끝납니다
+ */
+struct INVENTORY_API FInv_GridBitboard
+{
+public:
+
+	/**
+	 * 비트보드를 지정된 크기로 초기화합니다 (모든 비트는 0)
+	 * @param InRows 행 수
+	 * @param InColumns 열 수
+	 */
+	void Init(const int32 InRows, const int32 InColumns);
+
+	/** 모든 비트를 0으로 되돌립니다 (크기는 유지) */
+	void Reset();
+
+	/** 셀의 비트가 설정되어 있는지 확인합니다 */
+	bool IsSet(const int32 Column, const int32 Row) const;
+
+	/**
+	 * 사각형 영역의 모든 비트가 0인지 확인합니다
+	 * 영역은 그리드 경계 내에 있어야 합니다
+	 * @param Column 좌상단 열
+	 * @param Row 좌상단 행
+	 * @param Width 영역 너비
+	 * @param Height 영역 높이
+	 * @return 모든 비트가 0이면 true
+	 */
+	bool IsRectClear(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const;
+
+	/**
+	 * 사각형 영역의 비트를 설정하거나 해제합니다
+	 * 영역은 그리드 경계 내에 있어야 합니다
+	 * @param Column 좌상단 열
+	 * @param Row 좌상단 행
+	 * @param Width 영역 너비
+	 * @param Height 영역 높이
+	 * @param bValue 설정할 값
+	 */
+	void SetRect(const int32 Column, const int32 Row, const int32 Width, const int32 Height, const bool bValue);
+
+	/** 한 행의 점유 워드들의 시작 주소를 가져옵니다 (GetWordsPerRow()개) */
+	const uint64* GetRowWords(const int32 Row) const { return Words.GetData() + Row * WordsPerRow; }
+
+	/** 한 행을 저장하는 워드 수를 가져옵니다 */
+	int32 GetWordsPerRow() const { return WordsPerRow; }
+
+private:
+
+	/**
+	 * 한 행의 [Column, Column + Width) 구간에 대해 워드별 마스크를 적용합니다
+	 * @param Row 대상 행
+	 * @param Column 시작 열
+	 * @param Width 구간 너비
+	 * @param Func 워드 인덱스와 마스크를 받아 false를 반환하면 순회를 중단하는 함수
+	 * @return 순회가 중단되지 않았으면 true
+	 */
+	template<typename FuncT>
+	bool ForEachRowWord(const int32 Row, const int32 Column, const int32 Width, FuncT&& Func) const;
+
+	/** 행 우선으로 저장된 점유 워드 (한 행당 WordsPerRow개) */
+	TArray<uint64> Words;
+
+	/** 한 행을 저장하는 데 필요한 워드 수 */
+	int32 WordsPerRow{0};
+
+	/** 그리드의 행 수 */
+	int32 Rows{0};
+
+	/** 그리드의 열 수 */
+	int32 Columns{0};
+};
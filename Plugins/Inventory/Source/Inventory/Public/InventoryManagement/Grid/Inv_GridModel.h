@@ -0,0 +1,303 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InventoryManagement/Grid/Inv_FreeRectIndex.h"
+#include "InventoryManagement/Grid/Inv_GridBitboard.h"
+#include "InventoryManagement/Grid/Inv_GridSummedArea.h"
+#include "Types/Inv_GridTypes.h"
+
+struct FInv_ItemManifest;
+class UInv_InventoryItem;
+
+/**
+ * 그리드 모델에 배치된 하나의 스택 정보
+ * 아이템의 좌상단 인덱스를 키로 저장되며, 배치 검사에 필요한 값들을 매니페스트에서 미리 복사해 둡니다
+ * 배치 검사 중에는 아이템 UObject에 접근하지 않습니다
+ */
+struct FInv_GridPlacement
+{
+	/** 이 스택이 나타내는 인벤토리 아이템 (식별용, 배치 검사에는 사용하지 않음) */
+	TWeakObjectPtr<UInv_InventoryItem> Item;
+
+	/** 아이템 타입 GameplayTag */
+	FGameplayTag ItemType;
+
+	/** 아이템이 차지하는 크기 (너비, 높이, 회전이 반영된 값) */
+	FIntPoint Dimensions{1, 1};
+
+	/** 90도 회전해 배치되었는지 여부 */
+	bool bRotated{false};
+
+	/** 이 스택의 현재 수량 (스택 불가능 아이템은 0) */
+	int32 StackCount{0};
+
+	/** 한 스택에 쌓을 수 있는 최대 수량 */
+	int32 MaxStackSize{1};
+
+	/** 스택 가능한 아이템인지 여부 */
+	bool bStackable{false};
+};
+
+/**
+ * UObject와 위젯에 의존하지 않는 공간 인벤토리 그리드 모델
+ * 카테고리 하나의 점유 상태, 각 셀의 좌상단 인덱스, 스택 수량을 보관합니다
+ * 점유 상태는 비트보드로도 유지되어 배치 검사는 셀 단위 조회 대신 워드 단위 비트 연산으로 수행됩니다
+ * 호버 위치 검사의 영역 비어있음, 겹치는 아이템 수 확인은 누적 합 테이블로 영역 크기와 무관하게 수행됩니다
+ * 누적 합 테이블과 빈 사각형 인덱스는 임의의 WxH 영역을 다루므로 회전한 HxW 방향도 같은 자료구조로 검사합니다
+ * 빈 위치 검색은 최대 빈 사각형 인덱스를 사용하므로 모든 셀을 순회하지 않으며, 결과는 행 우선 첫 번째 맞춤과 같습니다
+ * 인벤토리 컴포넌트가 소유하며 데디케이티드 서버와 클라이언트 모두에서 동일한 배치 알고리즘을 실행합니다
+ * 그리드 위젯은 이 모델을 읽어 화면에 표시하는 뷰 역할만 합니다
+ */
+struct INVENTORY_API FInv_GridModel
+{
+public:
+
+	/**
+	 * 모델을 지정된 크기로 초기화합니다
+	 * 기존 배치 정보는 모두 제거됩니다
+	 * @param InRows 행 수
+	 * @param InColumns 열 수
+	 * @param InItemCategory 이 그리드가 담당하는 아이템 카테고리
+	 */
+	void Initialize(const int32 InRows, const int32 InColumns, const EInv_ItemCategory InItemCategory);
+
+	/** 모델이 초기화되었는지 확인합니다 */
+	bool IsInitialized() const { return Rows > 0 && Columns > 0; }
+
+	/** 그리드의 행 수를 가져옵니다 */
+	int32 GetRows() const { return Rows; }
+
+	/** 그리드의 열 수를 가져옵니다 */
+	int32 GetColumns() const { return Columns; }
+
+	/** 그리드의 전체 셀 수를 가져옵니다 */
+	int32 Num() const { return UpperLeftIndices.Num(); }
+
+	/** 이 그리드가 담당하는 아이템 카테고리를 가져옵니다 */
+	EInv_ItemCategory GetItemCategory() const { return ItemCategory; }
+
+	/**
+	 * 아이템 매니페스트를 위한 공간이 있는지 확인합니다
+	 * 행 우선(row-major) 순서로 첫 번째로 맞는 위치를 찾으며, 같은 타입의 스택이 있으면 먼저 채웁니다
+	 * 회전 가능한 아이템은 두 방향을 하나의 검색에서 함께 진행하며, 더 앞선 위치에 맞는 방향을 사용합니다
+	 * @param Manifest 확인할 아이템 매니페스트
+	 * @param StackAmountOverride -1이 아니면 매니페스트의 스택 수량 대신 사용할 수량
+	 * @param Orientation 새 스택에 허용하는 방향
+	 * @return 슬롯 사용 가능 여부 결과
+	 */
+	FInv_SlotAvailabilityResult HasRoomForItem(const FInv_ItemManifest& Manifest, const int32 StackAmountOverride = -1, const EInv_ItemOrientation Orientation = EInv_ItemOrientation::Any) const;
+
+	/**
+	 * 여러 아이템의 배치를 한 번에 계획합니다
+	 * 모델의 복사본에 앞선 아이템들의 배치를 누적하며 계산하므로, 뒤의 아이템은 앞의 아이템이 차지할 공간과 스택을 고려합니다
+	 * 모델 자체는 변경하지 않습니다
+	 * @param Manifests 배치할 아이템 매니페스트들 (nullptr 항목은 빈 결과)
+	 * @return 입력 순서대로의 아이템별 결과와 남은 수량
+	 */
+	FInv_PlacementPlan PlanPlacement(TArrayView<const FInv_ItemManifest*> Manifests) const;
+
+	/**
+	 * 호버 위치에 공간이 있는지 확인합니다
+	 * 영역이 비어있거나, 정확히 하나의 아이템과 겹치는지(교환 가능) 판단합니다
+	 * @param Position 확인할 좌상단 좌표
+	 * @param Dimensions 아이템 크기
+	 * @return 공간 쿼리 결과
+	 */
+	FInv_SpaceQueryResult CheckHoverPosition(const FIntPoint& Position, const FIntPoint& Dimensions) const;
+
+	/**
+	 * 아이템이 그리드 경계 내에 있는지 확인합니다
+	 * @param StartIndex 시작 인덱스
+	 * @param ItemDimensions 아이템 크기
+	 * @return 경계 내에 있는 경우 true
+	 */
+	bool IsInGridBounds(const int32 StartIndex, const FIntPoint& ItemDimensions) const;
+
+	/**
+	 * 지정된 영역이 모두 비어있는지 확인합니다
+	 * @param Index 시작 인덱스
+	 * @param Dimensions 영역 크기
+	 * @return 경계 내에 있고 모든 셀이 비어있으면 true
+	 */
+	bool IsAreaEmpty(const int32 Index, const FIntPoint& Dimensions) const;
+
+	/**
+	 * 공간 확인 결과를 모델에 적용합니다
+	 * 기존 스택에는 수량을 더하고, 빈 위치에는 새 스택을 배치합니다
+	 * @param Item 추가할 인벤토리 아이템
+	 * @param Result HasRoomForItem의 결과
+	 */
+	void AddItem(UInv_InventoryItem* Item, const FInv_SlotAvailabilityResult& Result);
+
+	/**
+	 * 지정된 인덱스에 아이템을 배치합니다
+	 * @param Item 배치할 인벤토리 아이템
+	 * @param Index 좌상단 인덱스
+	 * @param StackCount 스택 수량 (스택 불가능 아이템은 무시됨)
+	 * @param bRotated 90도 회전해 배치할지 여부 (회전할 수 없는 아이템은 무시됨)
+	 * @return 배치에 성공하면 true
+	 */
+	bool PlaceItem(UInv_InventoryItem* Item, const int32 Index, const int32 StackCount, const bool bRotated = false);
+
+	/**
+	 * 여러 스택의 이동을 한꺼번에 적용합니다
+	 * 이동할 스택을 모두 들어낸 뒤 새 위치에 배치하므로 서로의 자리를 바꾸는 이동도 가능합니다
+	 * 스택의 방향은 유지됩니다
+	 * 하나라도 적용할 수 없으면 모델은 변경되지 않습니다
+	 * @param Moves 적용할 이동 목록 (출발 위치는 스택의 좌상단 인덱스)
+	 * @return 모든 이동이 적용되었으면 true
+	 */
+	bool ApplyMoves(TArrayView<const FInv_GridMove> Moves);
+
+	/**
+	 * 지정된 인덱스를 차지하고 있는 아이템을 그리드에서 제거합니다
+	 * @param Index 아이템이 차지하는 아무 셀의 인덱스
+	 * @return 제거된 아이템의 좌상단 인덱스, 비어있었으면 INDEX_NONE
+	 */
+	int32 RemoveItem(const int32 Index);
+
+	/**
+	 * 지정된 인덱스에 있는 스택의 수량을 설정합니다
+	 * @param Index 아이템이 차지하는 아무 셀의 인덱스
+	 * @param StackCount 설정할 스택 수량
+	 */
+	void SetStackCount(const int32 Index, const int32 StackCount);
+
+	/**
+	 * 아이템이 배치된 모든 스택을 좌상단 인덱스 순서로 가져옵니다
+	 * 서버 배치를 인벤토리 엔트리에 기록하거나 클라이언트 모델을 엔트리와 비교할 때 사용됩니다
+	 * @param Item 찾을 인벤토리 아이템
+	 * @return 아이템의 스택들
+	 */
+	TArray<FInv_GridStack> GetItemStacks(const UInv_InventoryItem* Item) const;
+
+	/**
+	 * 아이템이 배치된 모든 스택을 제거합니다
+	 * @param Item 제거할 인벤토리 아이템
+	 * @return 제거한 스택 수
+	 */
+	int32 RemoveItemStacks(const UInv_InventoryItem* Item);
+
+	/** 셀이 점유되어 있는지 확인합니다 */
+	bool IsOccupied(const int32 Index) const { return GetUpperLeftIndex(Index) != INDEX_NONE; }
+
+	/** 셀을 차지하는 아이템의 좌상단 인덱스를 가져옵니다 (비어있으면 INDEX_NONE) */
+	int32 GetUpperLeftIndex(const int32 Index) const { return UpperLeftIndices.IsValidIndex(Index) ? UpperLeftIndices[Index] : INDEX_NONE; }
+
+	/** 셀을 차지하는 스택의 수량을 가져옵니다 (좌상단 셀에서 관리됨) */
+	int32 GetStackCount(const int32 Index) const;
+
+	/** 셀을 차지하는 인벤토리 아이템을 가져옵니다 */
+	UInv_InventoryItem* GetItem(const int32 Index) const;
+
+	/** 셀을 차지하는 스택의 배치 정보를 가져옵니다 */
+	const FInv_GridPlacement* FindPlacement(const int32 Index) const;
+
+	/** 점유 상태가 바뀔 때마다 증가하는 리비전을 가져옵니다 */
+	uint32 GetRevision() const { return Revision; }
+
+	/** 좌상단 인덱스를 키로 하는 모든 배치 정보를 가져옵니다 */
+	const TMap<int32, FInv_GridPlacement>& GetPlacements() const { return Placements; }
+
+	/**
+	 * 아이템 매니페스트에서 아이템의 크기를 가져옵니다
+	 * @param Manifest 아이템 매니페스트
+	 * @param bRotated 90도 회전한 방향의 크기를 가져올지 여부
+	 * @return 아이템 크기 (그리드 프래그먼트가 없으면 1x1)
+	 */
+	static FIntPoint GetItemDimensions(const FInv_ItemManifest& Manifest, const bool bRotated = false);
+
+	/**
+	 * 아이템을 90도 회전해 배치할 수 있는지 확인합니다
+	 * @param Manifest 아이템 매니페스트
+	 * @return 그리드 프래그먼트가 회전을 허용하고 정사각형이 아닌 경우 true
+	 */
+	static bool CanRotate(const FInv_ItemManifest& Manifest);
+
+	/**
+	 * 아이템 매니페스트가 그리드에 추가하려는 수량을 가져옵니다
+	 * @param Manifest 아이템 매니페스트
+	 * @return 스택 가능 아이템은 스택 수량, 그 외에는 1
+	 */
+	static int32 GetAmountToAdd(const FInv_ItemManifest& Manifest);
+
+private:
+
+	/**
+	 * 공간 확인 결과를 매니페스트 기준으로 모델에 적용합니다
+	 * @param Item 배치 정보에 기록할 인벤토리 아이템 (계획 중에는 nullptr)
+	 * @param Manifest 아이템 매니페스트
+	 * @param Result HasRoomForItem의 결과
+	 */
+	void ApplyResult(UInv_InventoryItem* Item, const FInv_ItemManifest& Manifest, const FInv_SlotAvailabilityResult& Result);
+
+	/**
+	 * 매니페스트 기준으로 지정된 인덱스에 새 스택을 배치합니다
+	 * @param Item 배치 정보에 기록할 인벤토리 아이템 (계획 중에는 nullptr)
+	 * @param Manifest 아이템 매니페스트
+	 * @param Index 좌상단 인덱스
+	 * @param StackCount 스택 수량
+	 * @param bRotated 90도 회전해 배치할지 여부 (회전할 수 없는 아이템은 무시됨)
+	 * @return 배치에 성공하면 true
+	 */
+	bool PlaceManifest(UInv_InventoryItem* Item, const FInv_ItemManifest& Manifest, const int32 Index, const int32 StackCount, const bool bRotated);
+
+	/**
+	 * 배치 정보를 지정된 인덱스에 기록합니다
+	 * @param Index 좌상단 인덱스
+	 * @param Placement 기록할 배치 정보
+	 * @return 영역이 비어있어 배치에 성공하면 true
+	 */
+	bool PlacePlacement(const int32 Index, FInv_GridPlacement&& Placement);
+
+	/**
+	 * 지정된 인덱스에 아이템을 배치할 공간이 있는지 확인합니다
+	 * 영역 내의 모든 셀이 비어있거나, 같은 타입의 가득 차지 않은 스택의 일부여야 합니다
+	 * @param Index 후보 좌상단 인덱스
+	 * @param Dimensions 아이템 크기
+	 * @param Claimed 이번 검사에서 이미 다른 스택에 할당된 셀들
+	 * @param ItemType 아이템 타입 GameplayTag
+	 * @param MaxStackSize 최대 스택 크기
+	 * @return 공간이 있는 경우 true
+	 */
+	bool HasRoomAtIndex(const int32 Index, const FIntPoint& Dimensions, const FInv_GridBitboard& Claimed, const FGameplayTag& ItemType, const int32 MaxStackSize) const;
+
+	/**
+	 * 스택의 배치나 수량이 바뀐 뒤 타입별 부분 스택 인덱스를 갱신합니다
+	 * @param UpperLeftIndex 스택의 좌상단 인덱스
+	 * @param Placement 스택의 배치 정보
+	 * @param bRemoved 스택이 그리드에서 제거되었는지 여부
+	 */
+	void UpdatePartialStackIndex(const int32 UpperLeftIndex, const FInv_GridPlacement& Placement, const bool bRemoved = false);
+
+	/** 셀마다 점유 여부를 비트로 기록한 비트보드 (UpperLeftIndices와 항상 같은 상태) */
+	FInv_GridBitboard Occupancy;
+
+	/** 영역 비어있음과 겹치는 아이템 수 확인에 사용하는 누적 합 테이블 (UpperLeftIndices와 함께 갱신됨) */
+	FInv_GridSummedArea SummedArea;
+
+	/** 빈 위치 검색에 사용하는 최대 빈 사각형 인덱스 (Occupancy와 함께 갱신됨) */
+	FInv_FreeRectIndex FreeRects;
+
+	/** 셀마다 해당 셀을 차지하는 아이템의 좌상단 인덱스 (비어있으면 INDEX_NONE) */
+	TArray<int32> UpperLeftIndices;
+
+	/** 좌상단 인덱스를 키로 하는 배치 정보 */
+	TMap<int32, FInv_GridPlacement> Placements;
+
+	/** 아이템 타입별로 가득 차지 않은 스택의 좌상단 인덱스 (오름차순) */
+	TMap<FGameplayTag, TArray<int32>> PartialStacksByType;
+
+	/** 점유 상태가 바뀔 때마다 증가하는 리비전 */
+	uint32 Revision{0};
+
+	/** 그리드의 행 수 */
+	int32 Rows{0};
+
+	/** 그리드의 열 수 */
+	int32 Columns{0};
+
+	/** 이 그리드가 담당하는 아이템 카테고리 */
+	EInv_ItemCategory ItemCategory{EInv_ItemCategory::None};
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 그리드 셀의 점유 상태와 아이템 경계를 누적 합 테이블(summed-area table)로 유지하는 인덱스
+ * 임의의 사각형에 대해 점유된 셀 수와 겹치는 서로 다른 아이템 수를 4번의 테이블 조회로 계산합니다
+ *
+ * 아이템은 겹치지 않는 사각형이므로, 사각형 R과 겹치는 아이템마다 "아이템과 R의 교집합의 좌상단 셀"이 정확히 하나 있습니다
+ * 그 셀은 R 안의 아이템 좌상단이거나, R의 왼쪽 열에서 위쪽 경계인 셀, R의 위쪽 행에서 왼쪽 경계인 셀, R의 좌상단 셀 중 하나이므로
+ * 각 경우의 셀 수를 누적 합으로 더하면 겹치는 아이템 수가 됩니다
+ */
+struct INVENTORY_API FInv_GridSummedArea
+{
+public:
+
+	/**
+	 * 테이블을 비어있는 그리드로 초기화합니다
+	 * @param InRows 행 수
+	 * @param InColumns 열 수
+	 */
+	void Init(const int32 InRows, const int32 InColumns);
+
+	/**
+	 * 점유 상태가 바뀐 뒤 테이블을 갱신합니다
+	 * 바뀐 영역의 좌상단부터 그리드 우하단까지만 다시 계산합니다 (경계 표시는 오른쪽과 아래쪽 이웃에만 영향을 줍니다)
+	 * @param UpperLeftIndices 셀마다 해당 셀을 차지하는 아이템의 좌상단 인덱스 (비어있으면 INDEX_NONE)
+	 * @param From 점유 상태가 바뀐 영역의 좌상단 좌표
+	 */
+	void Update(const TArray<int32>& UpperLeftIndices, const FIntPoint& From);
+
+	/**
+	 * 사각형 영역이 모두 비어있는지 확인합니다
+	 * 영역은 그리드 경계 내에 있어야 합니다
+	 * @param Column 좌상단 열
+	 * @param Row 좌상단 행
+	 * @param Width 영역 너비
+	 * @param Height 영역 높이
+	 * @return 점유된 셀이 없으면 true
+	 */
+	bool IsRectEmpty(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const;
+
+	/**
+	 * 사각형 영역과 겹치는 서로 다른 아이템의 수를 가져옵니다
+	 * 영역은 그리드 경계 내에 있어야 합니다
+	 * @param Column 좌상단 열
+	 * @param Row 좌상단 행
+	 * @param Width 영역 너비
+	 * @param Height 영역 높이
+	 * @return 겹치는 아이템 수
+	 */
+	int32 CountItems(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const;
+
+	/**
+	 * 사각형 영역 안에서 행 우선 순서로 첫 번째 점유된 셀을 찾습니다 (행과 열을 각각 이진 탐색)
+	 * 영역은 그리드 경계 내에 있어야 합니다
+	 * @param Column 좌상단 열
+	 * @param Row 좌상단 행
+	 * @param Width 영역 너비
+	 * @param Height 영역 높이
+	 * @return 셀 인덱스, 비어있으면 INDEX_NONE
+	 */
+	int32 FindFirstOccupied(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const;
+
+private:
+
+	/** 셀 하나 또는 누적 합 한 칸의 경계 표시 수 */
+	struct FCellCounts
+	{
+		/** 점유된 셀 */
+		int32 Occupied{0};
+
+		/** 아이템의 좌상단 셀 (위쪽 경계이면서 왼쪽 경계) */
+		int32 UpperLeft{0};
+
+		/** 위쪽 경계이지만 왼쪽 경계는 아닌 셀 */
+		int32 TopOnly{0};
+
+		/** 왼쪽 경계이지만 위쪽 경계는 아닌 셀 */
+		int32 LeftOnly{0};
+	};
+
+	/** [Column, Column + Width) x [Row, Row + Height) 영역의 경계 표시 합을 가져옵니다 */
+	FCellCounts SumRect(const int32 Column, const int32 Row, const int32 Width, const int32 Height) const;
+
+	/** 누적 합 테이블의 (Column, Row) 칸을 가져옵니다 (그리드보다 한 행, 한 열 큼) */
+	const FCellCounts& At(const int32 Column, const int32 Row) const { return Sums[Column + Row * (Columns + 1)]; }
+
+	/** 좌상단부터 각 칸까지의 경계 표시 합 ((Rows + 1) x (Columns + 1), 첫 행과 첫 열은 0) */
+	TArray<FCellCounts> Sums;
+
+	/** 위쪽과 왼쪽 어느 경계도 아닌 점유된 셀 여부 (좌상단 모서리에 걸친 아이템 판단에 사용) */
+	TBitArray<> Interior;
+
+	/** 그리드의 행 수 */
+	int32 Rows{0};
+
+	/** 그리드의 열 수 */
+	int32 Columns{0};
+};
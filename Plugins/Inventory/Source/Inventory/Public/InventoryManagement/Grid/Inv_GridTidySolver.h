@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Types/Inv_GridTypes.h"
+
+struct FInv_GridModel;
+
+/**
+ * 정리(tidy) 계산 결과
+ */
+struct FInv_TidyResult
+{
+	/** 정리한 그리드의 카테고리 */
+	EInv_ItemCategory Category{EInv_ItemCategory::None};
+
+	/** 스냅샷을 만들 당시 그리드 모델의 리비전 (적용 전에 그리드가 바뀌지 않았는지 확인하는 데 사용) */
+	uint32 Revision{0};
+
+	/** 위치가 바뀌는 스택들의 이동 목록 (제자리에 남는 스택은 포함하지 않음) */
+	TArray<FInv_GridMove> Moves;
+
+	/** 시간 예산 안에 모든 스택의 새 위치를 찾았는지 여부 */
+	bool bSolved{false};
+};
+
+/**
+ * 그리드를 정리하는 빈 패킹(bin packing) 솔버
+ * 게임 스레드에서 그리드 모델의 스냅샷을 만든 뒤, 워커 스레드에서 UObject에 접근하지 않고 계산합니다
+ * 스택들을 면적, 높이, 아이템 타입 순으로 정렬한 뒤 행 우선 첫 번째 맞춤으로 다시 배치합니다
+ */
+struct INVENTORY_API FInv_GridTidySolver
+{
+public:
+
+	/**
+	 * 그리드 모델의 현재 배치로부터 솔버를 만듭니다 (게임 스레드에서 호출)
+	 * @param GridModel 정리할 그리드 모델
+	 */
+	explicit FInv_GridTidySolver(const FInv_GridModel& GridModel);
+
+	/**
+	 * 새 배치를 계산합니다 (어느 스레드에서든 호출 가능)
+	 * @param TimeBudgetSeconds 계산에 사용할 최대 시간 (초), 초과하면 결과를 버립니다
+	 * @return 정리 결과
+	 */
+	FInv_TidyResult Solve(const double TimeBudgetSeconds) const;
+
+private:
+
+	/** 솔버가 다루는 스택 하나의 정보 */
+	struct FTidyItem
+	{
+		/** 현재 좌상단 인덱스 */
+		int32 UpperLeftIndex{INDEX_NONE};
+
+		/** 스택이 차지하는 크기 */
+		FIntPoint Dimensions{1, 1};
+
+		/** 아이템 타입 GameplayTag */
+		FGameplayTag ItemType;
+	};
+
+	/** 그리드의 모든 스택 */
+	TArray<FTidyItem> Items;
+
+	/** 정리한 그리드의 카테고리 */
+	EInv_ItemCategory Category{EInv_ItemCategory::None};
+
+	/** 스냅샷을 만들 당시 그리드 모델의 리비전 */
+	uint32 Revision{0};
+
+	/** 그리드의 행 수 */
+	int32 Rows{0};
+
+	/** 그리드의 열 수 */
+	int32 Columns{0};
+};
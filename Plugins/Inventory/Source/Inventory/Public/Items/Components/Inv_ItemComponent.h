@@ -34,6 +34,13 @@ public:
 	 */
 	void InitItemManifest(FInv_ItemManifest CopyOfManifest);
 
+	/**
+	 * 일부만 주워지고 남은 스택 수량을 설정합니다 (서버)
+	 * 매니페스트와 복제 데이터를 함께 바꿔 클라이언트에 전달되도록 합니다
+	 * @param StackCount 남은 스택 수량
+	 */
+	void SetRemainingStackCount(int32 StackCount);
+
 	/**
 	 * 아이템을 주웠을 때 표시할 메시지를 가져옵니다
 	 * @return 픽업 메시지 문자열
@@ -45,8 +52,7 @@ public:
 	 * @return 아이템 매니페스트 (프래그먼트, 카테고리, 타입 정보 포함)
 	 */
 	FInv_ItemManifest GetItemManifest() const { return ItemManifest; }
-	
-	FInv_ItemManifest& GetItemManifestMutable() { return ItemManifest; }
+
 	/**
 	 * 아이템이 주워졌을 때 호출되는 함수
 	 * OnPickedUp 블루프린트 이벤트를 발생시킵니다
@@ -55,6 +61,12 @@ public:
 
 protected:
 
+	/**
+	 * 에디터에서 작성된 매니페스트를 정의 레지스트리에 등록합니다
+	 * 서버에서는 매니페스트의 복제 데이터를 만듭니다
+	 */
+	virtual void BeginPlay() override;
+
 	/**
 	 * 아이템이 주워졌을 때 호출되는 블루프린트 구현 가능 이벤트
 	 * 블루프린트에서 이 이벤트를 구현하여 커스텀 픽업 효과를 추가할 수 있습니다
@@ -64,10 +76,18 @@ protected:
 
 private:
 
-	/** 이 아이템의 매니페스트 데이터 (복제됨) */
-	UPROPERTY(Replicated, EditAnywhere, Category = "Inventory")
+	/** 이 아이템의 매니페스트 데이터 (클라이언트는 InstanceData로 다시 만듦) */
+	UPROPERTY(EditAnywhere, Category = "Inventory")
 	FInv_ItemManifest ItemManifest;
 
+	/** 매니페스트 대신 복제되는 정의 ID, 롤 시드와 스택 수량 */
+	UPROPERTY(ReplicatedUsing = OnRep_InstanceData)
+	FInv_ItemInstanceData InstanceData;
+
+	/** 클라이언트에서 정의 레지스트리로 매니페스트를 복원합니다 */
+	UFUNCTION()
+	void OnRep_InstanceData();
+
 	/** 아이템을 주웠을 때 표시될 메시지 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	FString PickupMessage;
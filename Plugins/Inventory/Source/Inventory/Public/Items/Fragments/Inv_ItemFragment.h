@@ -8,6 +8,7 @@
 
 class AInv_EquipActor;
 class APlayerController;
+class UPackageMap;
 /**
  * 아이템 컴포지션 시스템의 기본 프래그먼트 구조체
  * 아이템은 여러 프래그먼트로 구성되며, 각 프래그먼트는 특정 동작이나 속성을 정의합니다
@@ -52,8 +53,21 @@ struct FInv_ItemFragment
 	 * 프래그먼트가 처음 생성될 때 호출되는 초기화 메서드입니다
 	 * 랜덤 값 생성, 초기 상태 설정 등의 용도로 사용됩니다
 	 * 파생 클래스에서 오버라이드하여 자체 초기화 로직을 구현할 수 있습니다
+	 *
+	 * 랜덤 값은 반드시 RandomStream에서 뽑아야 합니다
+	 * 매니페스트는 아이템의 시드로 만든 스트림을 프래그먼트 순서대로 넘기므로, 같은 시드면 어느 머신에서든 같은 값이 나옵니다
+	 * @param RandomStream 아이템의 롤 시드로 초기화된 난수 스트림
 	 */
-	virtual void Manifest() {}
+	virtual void Manifest(FRandomStream& RandomStream) {}
+
+	/**
+	 * 프래그먼트의 필드를 네트워크용으로 직렬화합니다 (FInv_ItemManifest::NetSerialize에서 사용)
+	 * 일반 프로퍼티 복제 대신 필요한 비트만 보내며, 파생 타입은 부모를 먼저 호출한 뒤 자신의 필드를 직렬화합니다
+	 * @param Ar 네트워크 아카이브
+	 * @param Map 오브젝트 참조와 태그를 직렬화할 패키지 맵
+	 * @param bOutSuccess 직렬화에 실패하면 false로 설정
+	 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
 	
 private:
 
@@ -70,29 +84,22 @@ private:
  *
  * 이 프래그먼트는 아이템 매니페스트의 데이터를 UI 위젯에 반영하는 데 사용됩니다
  * 예: 아이템 설명 위젯에 아이템 이름, 설명 등을 표시
+ *
+ * 동화는 포맷된 설명 항목을 페이로드에 추가하는 것이며, 페이로드는 아이템별로 캐시되어 위젯에 적용됩니다
  */
-class UInv_CompositeBase;
+struct FInv_ItemDescriptionPayload;
 USTRUCT(BlueprintType)
 struct FInv_InventoryItemFragment : public FInv_ItemFragment
 {
 	GENERATED_BODY()
 
 	/**
-	 * 이 프래그먼트의 데이터를 컴포지트 위젯에 동화(Assimilate)시킵니다
-	 * GameplayTag가 일치하는 경우에만 위젯을 확장(Expand)합니다
+	 * 이 프래그먼트의 데이터를 설명 페이로드에 동화(Assimilate)시킵니다
+	 * 기본 구현은 이 프래그먼트의 태그와 일치하는 위젯을 확장(Expand)만 하는 항목을 추가합니다
 	 *
-	 * @param Composite 데이터를 동화시킬 대상 컴포지트 위젯
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const;
-
-protected:
-	/**
-	 * 이 프래그먼트의 GameplayTag가 위젯의 Tag와 정확히 일치하는지 확인합니다
-	 *
-	 * @param Composite 태그를 비교할 대상 위젯
-	 * @return 태그가 정확히 일치하면 true, 아니면 false
-	 */
-	bool MatchesWidgetTag(const UInv_CompositeBase* Composite) const;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const;
 };
 
 
@@ -107,9 +114,16 @@ struct FInv_GridFragment : public FInv_ItemFragment
 
 	/**
 	 * 이 아이템의 그리드 크기를 가져옵니다
+	 * @param bRotated 90도 회전한 방향의 크기를 가져올지 여부
 	 * @return 그리드 셀 단위의 너비(X)와 높이(Y)를 담은 FIntPoint
 	 */
-	FIntPoint GetGridSize() const { return GridSize; }
+	FIntPoint GetGridSize(const bool bRotated = false) const { return bRotated ? FIntPoint(GridSize.Y, GridSize.X) : GridSize; }
+
+	/**
+	 * 이 아이템을 그리드에서 90도 회전해 배치할 수 있는지 확인합니다
+	 * @return 회전 가능하고 정사각형이 아닌 경우 true
+	 */
+	bool CanRotate() const { return bRotatable && GridSize.X != GridSize.Y; }
 
 	/**
 	 * 이 아이템의 그리드 크기를 설정합니다
@@ -129,12 +143,19 @@ struct FInv_GridFragment : public FInv_ItemFragment
 	 */
 	void SetGridPadding(float Padding) { GridPadding = Padding; }
 
+	/** 프래그먼트 필드를 네트워크용으로 직렬화합니다 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+
 private:
 
 	/** 그리드 셀 단위의 아이템 크기 (X = 너비, Y = 높이). 기본값은 1x1 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	FIntPoint GridSize {1, 1};
 
+	/** 그리드에서 90도 회전해 배치할 수 있는지 여부 (긴 무기 등) */
+	UPROPERTY(EditAnywhere, Category = "Inventory")
+	bool bRotatable {false};
+
 	/** 픽셀 단위의 아이템 주변 패딩. 기본값은 0 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	float GridPadding {0.f};
@@ -152,23 +173,27 @@ struct FInv_ImageFragment : public FInv_InventoryItemFragment
 
 	/**
 	 * 이 아이템의 아이콘 텍스처를 가져옵니다
-	 * @return 아이템 아이콘으로 사용되는 2D 텍스처 포인터
+	 * 소프트 레퍼런스이므로 아직 로드되지 않았을 수 있습니다 (UInv_IconStreamingSubsystem으로 로드)
+	 * @return 아이템 아이콘으로 사용되는 2D 텍스처의 소프트 레퍼런스
 	 */
-	UTexture2D* GetIcon() const { return Icon; }
+	const TSoftObjectPtr<UTexture2D>& GetIcon() const { return Icon; }
 
 	/**
-	 * 이미지 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
-	 * UInv_Leaf_Image 위젯에 아이콘과 크기 정보를 설정합니다
+	 * 이미지 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
+	 * UInv_Leaf_Image 위젯에 설정할 아이콘과 크기 정보를 추가합니다
 	 *
-	 * @param Composite 데이터를 동화시킬 컴포지트 위젯
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const override;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const override;
+
+	/** 프래그먼트 필드를 네트워크용으로 직렬화합니다 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 private:
 
-	/** 인벤토리 UI에서 아이템 아이콘으로 사용되는 2D 텍스처 */
+	/** 인벤토리 UI에서 아이템 아이콘으로 사용되는 2D 텍스처 (픽업과 아이템이 모든 아이콘을 상주시키지 않도록 소프트 레퍼런스) */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
-	TObjectPtr<UTexture2D> Icon {nullptr};
+	TSoftObjectPtr<UTexture2D> Icon;
 
 	/** 픽셀 단위의 아이콘 표시 크기. 기본값은 44x44 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
@@ -198,12 +223,15 @@ struct FInv_TextFragment : public FInv_InventoryItemFragment
 	void SetText(const FText& Text) { FragmentText = Text; }
 
 	/**
-	 * 텍스트 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
-	 * UInv_Leaf_Text 위젯에 텍스트 정보를 설정합니다
+	 * 텍스트 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
+	 * UInv_Leaf_Text 위젯에 설정할 텍스트 정보를 추가합니다
 	 *
-	 * @param Composite 데이터를 동화시킬 컴포지트 위젯
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const override;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const override;
+
+	/** 프래그먼트 필드를 네트워크용으로 직렬화합니다 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 private:
 	/** 프래그먼트가 저장하는 텍스트 데이터 */
@@ -229,19 +257,23 @@ struct FInv_LabeledNumberFragment : public FInv_InventoryItemFragment
 	GENERATED_BODY()
 
 	/**
-	 * 라벨과 숫자 데이터를 컴포지트 위젯에 동화시킵니다
-	 * UInv_Leaf_LabeledValue 위젯에 라벨과 포맷팅된 숫자 값을 설정합니다
+	 * 라벨과 숫자 데이터를 설명 페이로드에 동화시킵니다
+	 * UInv_Leaf_LabeledValue 위젯에 설정할 라벨과 포맷팅된 숫자 값을 추가합니다
 	 *
-	 * @param Composite 데이터를 동화시킬 컴포지트 위젯
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const override;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const override;
 
 	/**
 	 * 프래그먼트 초기화 시 랜덤 값을 생성합니다
 	 * bRandomizeOnManifest가 true일 때 Min~Max 범위에서 Value를 랜덤 설정합니다
 	 * 한 번 실행 후 bRandomizeOnManifest를 false로 설정하여 값을 고정합니다
+	 * 뒤따르는 프래그먼트의 값이 바뀌지 않도록 고정된 경우에도 스트림에서 값을 하나 뽑습니다
 	 */
-	virtual void Manifest() override;
+	virtual void Manifest(FRandomStream& RandomStream) override;
+
+	/** 프래그먼트 필드를 네트워크용으로 직렬화합니다 (수치는 MaxFractionalDigits 자릿수로 양자화) */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 	/**
 	 * 프래그먼트가 저장하고 있는 현재 숫자 값을 가져옵니다
@@ -317,6 +349,9 @@ struct FInv_StackableFragment : public FInv_ItemFragment
 	 */
 	void SetStackCount(int32 Count) { StackCount = Count; }
 
+	/** 프래그먼트 필드를 네트워크용으로 직렬화합니다 (스택 수량은 MaxStackSize에 필요한 비트만 사용) */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+
 private:
 
 	/** 함께 스택할 수 있는 아이템의 최대 개수. 기본값은 1 (스택 불가) */
@@ -371,17 +406,20 @@ struct FInv_ConsumableFragment : public FInv_InventoryItemFragment
 	virtual void OnConsume(APlayerController* PC);
 
 	/**
-	 * 소비형 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
-	 * 모든 ConsumeModifier의 데이터를 순회하며 각각 위젯에 동화시킵니다
-	 * @param Composite 데이터를 동화시킬 컴포지트 위젯
+	 * 소비형 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
+	 * 모든 ConsumeModifier의 데이터를 순회하며 각각 동화시킵니다
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const override;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const override;
 
 	/**
 	 * 프래그먼트 초기화 시 모든 수정자를 초기화합니다
 	 * 각 ConsumeModifier의 Manifest()를 호출하여 랜덤 값 등을 생성합니다
 	 */
-	virtual void Manifest() override;
+	virtual void Manifest(FRandomStream& RandomStream) override;
+
+	/** 모든 ConsumeModifier를 네트워크용으로 직렬화합니다 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 private:
 	/**
@@ -509,17 +547,20 @@ struct FInv_EquipmentFragment : public FInv_InventoryItemFragment
 	void OnUnequip(APlayerController* PC);
 
 	/**
-	 * 장비 프래그먼트 데이터를 컴포지트 위젯에 동화시킵니다
-	 * 모든 EquipModifier의 데이터를 순회하며 각각 위젯에 동화시킵니다
-	 * @param Composite 데이터를 동화시킬 컴포지트 위젯
+	 * 장비 프래그먼트 데이터를 설명 페이로드에 동화시킵니다
+	 * 모든 EquipModifier의 데이터를 순회하며 각각 동화시킵니다
+	 * @param Payload 설명 항목을 추가할 페이로드
 	 */
-	virtual void Assimilate(UInv_CompositeBase* Composite) const override;
+	virtual void Assimilate(FInv_ItemDescriptionPayload& Payload) const override;
 
 	/**
 	 * 프래그먼트 초기화 시 모든 수정자를 초기화합니다
 	 * 각 EquipModifier의 Manifest()를 호출하여 랜덤 스탯 값 등을 생성합니다
 	 */
-	virtual void Manifest() override;
+	virtual void Manifest(FRandomStream& RandomStream) override;
+
+	/** 모든 EquipModifier와 장비 정보를 네트워크용으로 직렬화합니다 */
+	virtual void NetSerializeFragment(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 	/**
 	 * 장비 액터를 스폰하고 지정된 소켓에 부착합니다
@@ -571,4 +612,90 @@ private:
 	/** 장비 타입을 식별하는 GameplayTag (같은 타입의 장비는 동시에 하나만 장착 가능) */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	FGameplayTag EquipmentType {FGameplayTag::EmptyTag};
-};
\ No newline at end of file
+};
+
+/**
+ * 네트워크 직렬화에서 타입 경로 대신 인덱스로 보내는 플러그인 기본 프래그먼트 타입의 인덱스를 가져옵니다
+ * @param FragmentType 프래그먼트 타입
+ * @return 1부터 시작하는 인덱스, 기본 타입이 아니면 0
+ */
+INVENTORY_API uint32 GetBuiltInFragmentTypeIndex(const UScriptStruct* FragmentType);
+
+/**
+ * 인덱스에 해당하는 플러그인 기본 프래그먼트 타입을 가져옵니다
+ * @param TypeIndex GetBuiltInFragmentTypeIndex가 반환한 인덱스
+ * @return 프래그먼트 타입, 없으면 nullptr
+ */
+INVENTORY_API const UScriptStruct* GetBuiltInFragmentType(uint32 TypeIndex);
+
+/** 기본 프래그먼트 타입 인덱스의 상한 (인덱스를 이 값보다 작은 비트 수로 보냄) */
+inline constexpr uint32 MaxBuiltInFragmentTypes{16};
+
+/** 네트워크로 받을 프래그먼트 배열의 최대 길이 (잘못된 패킷이 큰 배열을 할당하지 않도록) */
+inline constexpr uint32 MaxNetFragments{64};
+
+/**
+ * 인스턴스 구조체에 담긴 프래그먼트 하나를 네트워크용으로 직렬화합니다
+ * 기본 프래그먼트 타입은 타입 인덱스와 NetSerializeFragment로 보내고,
+ * 프로젝트에서 추가한 타입은 타입 경로를 포함한 일반 인스턴스 구조체 직렬화로 보냅니다
+ */
+template<typename T> requires std::derived_from<T, FInv_ItemFragment>
+void NetSerializeInstancedFragment(TInstancedStruct<T>& Fragment, FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 TypeIndex = Ar.IsSaving() ? GetBuiltInFragmentTypeIndex(Fragment.GetScriptStruct()) : 0;
+	Ar.SerializeInt(TypeIndex, MaxBuiltInFragmentTypes);
+
+	if (TypeIndex == 0)
+	{
+		// 인스턴스 구조체 직렬화가 앞선 실패를 덮어쓰지 않도록 결과를 따로 받습니다
+		bool bFragmentSuccess = true;
+		Fragment.NetSerialize(Ar, Map, bFragmentSuccess);
+		bOutSuccess &= bFragmentSuccess;
+		return;
+	}
+
+	if (Ar.IsLoading())
+	{
+		const UScriptStruct* FragmentType = GetBuiltInFragmentType(TypeIndex);
+		if (!FragmentType || !FragmentType->IsChildOf(T::StaticStruct()))
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return;
+		}
+		Fragment.InitializeAsScriptStruct(FragmentType);
+	}
+	Fragment.GetMutable().NetSerializeFragment(Ar, Map, bOutSuccess);
+}
+
+/**
+ * 프래그먼트 배열을 길이와 각 프래그먼트로 직렬화합니다
+ * 설명 표시와 롤 순서가 배열 순서를 따르므로 순서 그대로 보냅니다
+ */
+template<typename T> requires std::derived_from<T, FInv_ItemFragment>
+void NetSerializeFragmentArray(TArray<TInstancedStruct<T>>& Fragments, FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 NumFragments = Fragments.Num();
+	Ar.SerializeIntPacked(NumFragments);
+	if (Ar.IsLoading())
+	{
+		if (NumFragments > MaxNetFragments)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return;
+		}
+		Fragments.Reset(NumFragments);
+		Fragments.SetNum(NumFragments);
+	}
+
+	for (TInstancedStruct<T>& Fragment : Fragments)
+	{
+		NetSerializeInstancedFragment(Fragment, Ar, Map, bOutSuccess);
+		if (Ar.IsError())
+		{
+			bOutSuccess = false;
+			return;
+		}
+	}
+}
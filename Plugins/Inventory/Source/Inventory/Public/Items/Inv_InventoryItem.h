@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Items/Manifest/Inv_ItemManifest.h"
+#include "Widgets/ItemDescription/Inv_ItemDescriptionPayload.h"
 #include "Inv_InventoryItem.generated.h"
 
 /**
@@ -41,14 +42,52 @@ public:
 	 * @return 아이템의 FInv_ItemManifest 참조. 이 매니페스트는 아이템의 주요 정보와 관련된 데이터를 포함합니다.
 	 */
 	const FInv_ItemManifest& GetItemManifest() const { return ItemManifest.Get<FInv_ItemManifest>(); }
+	/**
+	 * 매니페스트가 설정되어 있는지 확인합니다.
+	 * 클라이언트에서는 InstanceData가 복제되어 매니페스트를 복원하기 전까지 false이며, 그 전에는 GetItemManifest를 호출하면 안 됩니다.
+	 *
+	 * @return 매니페스트가 있으면 true
+	 */
+	bool HasItemManifest() const { return ItemManifest.IsValid(); }
+	/**
+	 * 매니페스트 대신 복제되는 정의 ID, 롤 시드와 스택 수량을 반환합니다.
+	 *
+	 * @return 아이템의 복제 데이터
+	 */
+	const FInv_ItemInstanceData& GetInstanceData() const { return InstanceData; }
+	/**
+	 * 복제된 InstanceData와 정의 레지스트리로 매니페스트를 복원합니다. (클라이언트에서만)
+	 * 레지스트리에 정의가 없으면 인벤토리 컴포넌트를 통해 서버에 정의를 요청하며, 정의를 받으면 다시 호출됩니다.
+	 * 복원되면 인벤토리 컴포넌트에 알려 보류된 엔트리를 추가된 것으로 처리합니다.
+	 *
+	 * @return 매니페스트를 복원했으면 true
+	 */
+	bool RebuildItemManifest();
 	/**
 	 * @brief FInv_ItemManifest 객체의 수정 가능한 참조를 반환합니다.
 	 *
 	 * 이 메서드는 ItemManifest의 내용을 수정할 수 있도록 FInv_ItemManifest 타입의 참조를 반환합니다.
 	 *
+	 * 수정될 수 있으므로 매니페스트 리비전이 증가합니다.
+	 *
 	 * @return FInv_ItemManifest& 수정 가능한 FInv_ItemManifest 객체의 참조를 반환합니다.
 	 */
-	FInv_ItemManifest& GetItemManifestMutable() { return ItemManifest.GetMutable<FInv_ItemManifest>(); }
+	FInv_ItemManifest& GetItemManifestMutable() { ++ManifestRevision; return ItemManifest.GetMutable<FInv_ItemManifest>(); }
+
+	/**
+	 * 매니페스트가 설정, 수정 또는 복제될 때마다 증가하는 리비전을 반환합니다.
+	 *
+	 * @return 매니페스트 리비전
+	 */
+	uint32 GetManifestRevision() const { return ManifestRevision; }
+
+	/**
+	 * 아이템 설명 위젯에 적용할 포맷된 설명 페이로드를 반환합니다.
+	 * 매니페스트 리비전과 현재 로캘이 캐시와 같으면 다시 포맷하지 않고 캐시를 반환합니다.
+	 *
+	 * @return 설명 페이로드
+	 */
+	const FInv_ItemDescriptionPayload& GetDescriptionPayload() const;
 	/**
 	 * 이 함수는 현재 인벤토리 아이템이 스택 가능 여부를 확인합니다.
 	 *
@@ -65,6 +104,7 @@ public:
 	int32 GetTotalStackCount() const { return TotalStackCount; }
 	/**
 	 * 총 스택 개수를 설정합니다.
+	 * 서버에서는 FInv_InventoryFastArray::SetEntryStackCount를 통해 엔트리와 함께 바꿔야 복제됩니다.
 	 *
 	 * @param Count 설정할 총 스택 개수입니다.
 	 */
@@ -75,24 +115,41 @@ private:
 	 *
 	 * ItemManifest 변수는 FInv_ItemManifest 구조체의 인스턴스를 나타내며,
 	 * 아이템의 카테고리, 유형, 그리고 태그로 필터링된 프래그먼트 정보를 제공합니다.
-	 * 이 변수는 네트워크 동기화를 위해 복제되며, 직렬화된 메모리 구조를 가진 FInstancedStruct를 기반으로 구현됩니다.
+	 * 직렬화된 메모리 구조를 가진 FInstancedStruct를 기반으로 구현됩니다.
 	 *
 	 * @details
 	 * - 사용자는 Setter 및 Getter 메서드를 통해 이 변수를 수정하거나 액세스할 수 있습니다.
-	 * - 네트워크 복제를 지원하며, UInv_InventoryItem 클래스 내에서 DOREPLIFETIME 매크로를 통해 동기화됩니다.
+	 * - 직접 복제되지 않으며, 클라이언트는 복제된 InstanceData와 정의 레지스트리로 다시 만듭니다.
 	 * - BaseStruct로 지정된 "Inv_ItemManifest" 구조체를 참조합니다.
 	 */
-	UPROPERTY(VisibleAnywhere, meta = (BaseStruct = "/Script/Inventory.Inv_ItemManifest"), Replicated)
+	UPROPERTY(VisibleAnywhere, meta = (BaseStruct = "/Script/Inventory.Inv_ItemManifest"))
 	FInstancedStruct ItemManifest;
 
+	/**
+	 * 매니페스트 대신 복제되는 정의 ID, 롤 시드와 스택 수량입니다.
+	 * 아이템이 만들어질 때 한 번 정해지므로 처음 복제될 때만 보냅니다.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_InstanceData)
+	FInv_ItemInstanceData InstanceData;
+
+	/** 클라이언트에서 RebuildItemManifest로 매니페스트를 복원합니다 */
+	UFUNCTION()
+	void OnRep_InstanceData();
+
+	/** 매니페스트가 바뀔 때마다 증가하는 리비전 (설명 페이로드 캐시의 키) */
+	uint32 ManifestRevision{0};
+
+	/** 캐시된 설명 페이로드 (GetDescriptionPayload에서 필요할 때 다시 만듦) */
+	mutable FInv_ItemDescriptionPayload DescriptionPayload;
+
 	/**
 	 * TotalStackCount는 이 인벤토리 아이템에 대한 현재 전체 스택 개수를 나타냅니다.
 	 *
-	 * - 네트워크 동기화를 위해 Replicated 속성이 적용되었습니다.
+	 * - 직접 복제되지 않으며, 인벤토리 엔트리(FInv_InventoryEntry)의 스택 수량이 Fast Array 델타로 복제되어 반영됩니다.
 	 * - 이 값은 GetTotalStackCount()를 통해 접근하거나 SetTotalStackCount()를 이용해 설정할 수 있습니다.
 	 * - 인벤토리 시스템 내에서 스택 가능한 아이템의 누적 개수를 관리하는 데 사용됩니다.
 	 */
-	UPROPERTY(Replicated)
+	UPROPERTY(VisibleAnywhere)
 	int32 TotalStackCount {0};
 };
 
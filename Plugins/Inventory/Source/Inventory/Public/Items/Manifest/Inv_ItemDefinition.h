@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Items/Manifest/Inv_ItemManifest.h"
+#include "Inv_ItemDefinition.generated.h"
+
+/**
+ * 아이템 타입 하나의 정의 매니페스트를 담는 데이터 에셋
+ * 프라이머리 에셋 ID의 이름이 아이템 타입 태그이므로, 정의 레지스트리가 복제된 정의 ID만으로 찾아 로드할 수 있습니다
+ * 에셋 매니저 설정의 Primary Asset Types to Scan에 "Inv_ItemDefinition" 타입을 추가해야 합니다
+ */
+UCLASS(BlueprintType)
+class INVENTORY_API UInv_ItemDefinition : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** 아이템 정의의 프라이머리 에셋 타입 */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/**
+	 * 정의 매니페스트를 가져옵니다
+	 * @return 인스턴스 값이 적용되지 않은 매니페스트
+	 */
+	const FInv_ItemManifest& GetItemManifest() const { return ItemManifest; }
+
+private:
+
+	/** 이 아이템 타입의 정의 매니페스트 */
+	UPROPERTY(EditDefaultsOnly, Category = "Inventory")
+	FInv_ItemManifest ItemManifest;
+};
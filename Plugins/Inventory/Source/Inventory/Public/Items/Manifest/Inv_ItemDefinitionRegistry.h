@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Items/Manifest/Inv_ItemManifest.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Inv_ItemDefinitionRegistry.generated.h"
+
+/**
+ * 아이템 타입 태그(정의 ID)로 정의 매니페스트를 찾는 레지스트리
+ * 아이템은 정의 ID와 롤 시드(FInv_ItemInstanceData)만 복제하고, 받는 쪽은 이 레지스트리로 전체 매니페스트를 복원합니다
+ *
+ * 정의는 세 곳에서 옵니다
+ * - 월드의 픽업 아이템 컴포넌트가 BeginPlay에서 등록하는 에디터에서 작성된 매니페스트
+ * - 등록되지 않은 타입을 찾을 때 에셋 매니저로 로드하는 UInv_ItemDefinition 에셋
+ * - 둘 다 없는 클라이언트가 인벤토리 컴포넌트를 통해 서버에 요청해 받은 정의 (타입마다 한 번만 전송됨)
+ */
+UCLASS()
+class INVENTORY_API UInv_ItemDefinitionRegistry : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * 월드 컨텍스트의 게임 인스턴스에서 레지스트리를 가져옵니다
+	 * @param WorldContextObject 월드 컨텍스트 객체
+	 * @return 레지스트리, 게임 인스턴스가 없으면 nullptr
+	 */
+	static UInv_ItemDefinitionRegistry* Get(const UObject* WorldContextObject);
+
+	/**
+	 * 정의 매니페스트를 등록합니다
+	 * 이미 등록된 타입이면 무시합니다 (먼저 등록된 정의를 유지)
+	 * @param Manifest 인스턴스 값이 적용되지 않은 매니페스트
+	 */
+	void RegisterDefinition(const FInv_ItemManifest& Manifest);
+
+	/**
+	 * 아이템 타입의 정의 매니페스트를 찾습니다
+	 * 등록되지 않은 타입이면 같은 이름의 UInv_ItemDefinition 에셋을 동기 로드해 등록합니다
+	 * @param ItemType 정의 ID
+	 * @return 정의 매니페스트, 없으면 nullptr
+	 */
+	const FInv_ItemManifest* FindDefinition(const FGameplayTag& ItemType);
+
+	/**
+	 * 복제 데이터로 전체 매니페스트를 복원합니다
+	 * @param InstanceData 정의 ID, 롤 시드와 스택 수량
+	 * @param OutManifest 복원한 매니페스트
+	 * @return 정의를 찾았으면 true
+	 */
+	bool BuildManifest(const FInv_ItemInstanceData& InstanceData, FInv_ItemManifest& OutManifest);
+
+private:
+
+	/** 아이템 타입별 정의 매니페스트 */
+	UPROPERTY()
+	TMap<FGameplayTag, FInv_ItemManifest> Definitions;
+};
@@ -8,7 +8,9 @@
 
 class UInv_CompositeBase;
 struct FInv_ItemFragment;
+struct FInv_ItemDescriptionPayload;
 class UInv_InventoryItem;
+struct FInv_ItemInstanceData;
 
 /**
  * 아이템 매니페스트 구조체
@@ -46,6 +48,25 @@ struct INVENTORY_API FInv_ItemManifest
 	 */
 	FGameplayTag GetItemType() const { return ItemType; }
 
+	/**
+	 * 이 아이템 인스턴스의 롤 시드를 가져옵니다
+	 * 정의 매니페스트에 같은 시드로 롤하면 어느 머신에서든 같은 수치가 나오므로 서버와 클라이언트의 값을 검증할 수 있습니다
+	 * @return 롤 시드, 아직 롤하지 않았으면 0
+	 */
+	int32 GetRollSeed() const { return RollSeed; }
+
+	/**
+	 * 이 매니페스트에서 인스턴스마다 다른 값만 뽑아 복제 데이터를 만듭니다
+	 * @return 정의 ID, 롤 시드와 스택 수량
+	 */
+	FInv_ItemInstanceData MakeInstanceData() const;
+
+	/**
+	 * 복제 데이터의 롤 시드로 이 매니페스트(보통 정의 매니페스트의 복사본)를 다시 롤하고 스택 수량을 적용합니다
+	 * @param InstanceData 적용할 복제 데이터
+	 */
+	void ApplyInstanceData(const FInv_ItemInstanceData& InstanceData);
+
 	/**
 	 * 이 매니페스트의 모든 인벤토리 아이템 프래그먼트를 컴포지트 위젯에 동화시킵니다
 	 * FInv_InventoryItemFragment 타입의 모든 프래그먼트를 찾아서 각각을 위젯에 적용합니다
@@ -54,6 +75,14 @@ struct INVENTORY_API FInv_ItemManifest
 	 * @param Composite 프래그먼트 데이터를 동화시킬 대상 컴포지트 위젯
 	 */
 	void AssimilateInventoryFragments(UInv_CompositeBase* Composite) const;
+
+	/**
+	 * 이 매니페스트의 모든 인벤토리 아이템 프래그먼트를 설명 페이로드에 동화시킵니다
+	 * 페이로드는 위젯 없이 포맷된 설명 항목만 가지므로 아이템별로 캐시해 여러 설명 위젯에 적용할 수 있습니다
+	 *
+	 * @param OutPayload 설명 항목을 추가할 페이로드
+	 */
+	void BuildDescriptionPayload(FInv_ItemDescriptionPayload& OutPayload) const;
 	
 	/**
 	 * 특정 GameplayTag를 가진 프래그먼트를 타입별로 검색합니다
@@ -99,6 +128,15 @@ struct INVENTORY_API FInv_ItemManifest
 	 * @param SpawnRotation 픽업 액터의 초기 회전
 	 */
 	void SpawnPickupActor(const UObject* WorldContextObject, const FVector& SpawnLocation, const FRotator& SpawnRotation);
+
+	/**
+	 * 매니페스트를 네트워크용으로 직렬화합니다
+	 * 일반 프로퍼티 복제는 프래그먼트마다 구조체 경로, 전체 float, 태그 이름을 보내므로 직접 직렬화합니다
+	 * - 플러그인 기본 프래그먼트는 구조체 경로 대신 4비트 타입 인덱스로 보냅니다
+	 * - 태그는 FGameplayTag::NetSerialize로 보내므로 Fast Replication을 켜면 네트 인덱스가 됩니다
+	 * - 라벨 수치의 표시 값은 MaxFractionalDigits로 양자화하고(롤 범위 Min/Max는 전체 정밀도), 스택 수량은 MaxStackSize에 필요한 비트만 사용합니다
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
 private:
 
 	/**
@@ -107,6 +145,12 @@ private:
 	 */
 	void ClearFragments();
 
+	/**
+	 * 롤 시드로 난수 스트림을 만들어 프래그먼트 순서대로 Manifest()를 호출합니다
+	 * 프래그먼트는 이 스트림에서만 값을 뽑으므로 같은 시드와 같은 정의면 항상 같은 수치가 나옵니다
+	 */
+	void RollFragments();
+
 	/** 이 아이템을 구성하는 프래그먼트들의 배열 (그리드, 이미지, 스택 등) */
 	UPROPERTY(EditAnywhere, Category = "Inventory", meta = (ExcludeBaseStruct))
 	TArray<TInstancedStruct<FInv_ItemFragment>> Fragments;
@@ -119,11 +163,69 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Inventory", meta = (Categories = "GameItems"))
 	FGameplayTag ItemType;
 
+	/** 이 아이템 인스턴스의 랜덤 수치를 만드는 시드 (처음 Manifest()할 때 정해지며 드롭 후 다시 주워도 유지됨) */
+	UPROPERTY(VisibleAnywhere, Category = "Inventory")
+	int32 RollSeed{0};
+
 	/** 월드에 스폰될 픽업 액터의 클래스 (드롭되거나 배치될 때 사용) */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	TSubclassOf<AActor> PickupActorClass;
 };
 
+/**
+ * FInv_ItemManifest에 대한 구조체 특성 정의
+ * 직접 작성한 네트워크 직렬화를 사용합니다
+ */
+template<>
+struct TStructOpsTypeTraits<FInv_ItemManifest> : public TStructOpsTypeTraitsBase2<FInv_ItemManifest>
+{
+	/** 이 구조체가 NetSerialize로 직렬화됨을 나타냅니다 */
+	enum { WithNetSerializer = true };
+};
+
+/**
+ * 아이템 인스턴스의 복제 데이터
+ * 아이템 타입별로 고정된 데이터(프래그먼트, 텍스트, 아이콘 등)는 보내지 않고 정의 ID와 인스턴스마다 다른 값만 복제합니다
+ * 받는 쪽은 UInv_ItemDefinitionRegistry에서 정의 매니페스트를 찾아 이 데이터를 적용해 전체 매니페스트를 복원합니다
+ */
+USTRUCT()
+struct INVENTORY_API FInv_ItemInstanceData
+{
+	GENERATED_BODY()
+
+	/** 정의 ID (아이템의 고유 타입 태그) */
+	UPROPERTY()
+	FGameplayTag ItemType;
+
+	/** 랜덤 수치를 만드는 롤 시드 (0이면 아직 롤하지 않은 정의 그대로의 매니페스트) */
+	UPROPERTY()
+	int32 RollSeed{0};
+
+	/** 스택 가능 프래그먼트의 스택 수량 */
+	UPROPERTY()
+	int32 StackCount{0};
+
+	/** 정의 ID가 있으면 true */
+	bool IsValid() const { return ItemType.IsValid(); }
+
+	/**
+	 * 복제 데이터를 직렬화합니다
+	 * 태그는 네트 인덱스로, 스택 수량은 가변 길이로 보내고 롤 시드는 있을 때만 보냅니다
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+/**
+ * FInv_ItemInstanceData에 대한 구조체 특성 정의
+ * 직접 작성한 네트워크 직렬화를 사용합니다
+ */
+template<>
+struct TStructOpsTypeTraits<FInv_ItemInstanceData> : public TStructOpsTypeTraitsBase2<FInv_ItemInstanceData>
+{
+	/** 이 구조체가 NetSerialize로 직렬화됨을 나타냅니다 */
+	enum { WithNetSerializer = true };
+};
+
 /**
  * 특정 GameplayTag를 가진 프래그먼트를 타입별로 검색하는 템플릿 함수 구현
  * Fragments 배열을 순회하며 타입과 태그가 모두 일치하는 프래그먼트를 찾습니다
@@ -61,6 +61,11 @@ private:
 	 */
 	void PrimaryInteract();
 
+	/**
+	 * 인벤토리 메뉴가 열려있으면 들고 있는 아이템을 90도 회전합니다
+	 */
+	void RotateHoverItem();
+
 	/**
 	 * HUD 위젯을 생성하고 뷰포트에 추가합니다
 	 */
@@ -87,6 +92,10 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Inventory")
 	TObjectPtr<UInputAction> ToggleInventoryAction;
 
+	/** 들고 있는 아이템 회전 입력 액션 */
+	UPROPERTY(EditDefaultsOnly, Category = "Inventory")
+	TObjectPtr<UInputAction> RotateItemAction;
+
 	/** HUD 위젯 클래스 */
 	UPROPERTY(EditDefaultsOnly, Category = "Inventory")
 	TSubclassOf<UInv_HUDWidget> HUDWidgetClass;
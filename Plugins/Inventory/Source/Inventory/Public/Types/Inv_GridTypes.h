@@ -24,6 +24,23 @@ enum class EInv_ItemCategory : uint8
 	None
 };
 
+/**
+ * 그리드에 아이템을 배치할 때 허용하는 방향을 나타내는 열거형
+ * 회전할 수 없는 아이템은 항상 원래 방향으로 배치됩니다
+ */
+UENUM(BlueprintType)
+enum class EInv_ItemOrientation : uint8
+{
+	/** 두 방향 중 행 우선 순서로 먼저 맞는 방향 (같은 위치면 원래 방향) */
+	Any,
+
+	/** 원래 방향만 */
+	Upright,
+
+	/** 90도 회전한 방향만 */
+	Rotated
+};
+
 /**
  * 단일 슬롯의 사용 가능 여부 정보를 나타내는 구조체
  * 스택 가능한 아이템의 슬롯 공간 계산에 사용됩니다
@@ -41,8 +58,9 @@ struct FInv_SlotAvailability
 	 * @param ItemIndex 슬롯의 인덱스
 	 * @param Room 채울 수 있는 아이템 수량
 	 * @param bHasItem 슬롯에 이미 아이템이 있는지 여부
+	 * @param bRotatedItem 새 스택을 90도 회전해 배치하는지 여부
 	 */
-	FInv_SlotAvailability(int32 ItemIndex, int32 Room, bool bHasItem) : Index(ItemIndex), AmountToFill(Room), bItemAtIndex(bHasItem) {};
+	FInv_SlotAvailability(int32 ItemIndex, int32 Room, bool bHasItem, bool bRotatedItem = false) : Index(ItemIndex), AmountToFill(Room), bItemAtIndex(bHasItem), bRotated(bRotatedItem) {};
 
 	/** 인벤토리 슬롯의 인덱스 */
 	int32 Index{INDEX_NONE};
@@ -52,6 +70,9 @@ struct FInv_SlotAvailability
 
 	/** 해당 슬롯에 아이템이 있는지 여부 */
 	bool bItemAtIndex{false};
+
+	/** 빈 슬롯에 새 스택을 90도 회전해 배치하는지 여부 (기존 스택은 원래 방향을 유지) */
+	bool bRotated{false};
 };
 
 /**
@@ -82,6 +103,95 @@ struct FInv_SlotAvailabilityResult
 	TArray<FInv_SlotAvailability> SlotAvailabilities;
 };
 
+/**
+ * 여러 아이템을 한 번에 배치하는 계획 결과를 담는 구조체
+ * 아이템마다 입력 순서대로 하나의 슬롯 공간 확인 결과를 가지며, 앞선 아이템의 배치를 반영해 계산되므로 순서대로 적용해야 합니다
+ */
+USTRUCT()
+struct FInv_PlacementPlan
+{
+	GENERATED_BODY()
+
+	/** 입력 순서대로의 아이템별 슬롯 공간 확인 결과 */
+	TArray<FInv_SlotAvailabilityResult> Results;
+
+	/** 입력 순서대로의 아이템별 배치하지 못한 수량 */
+	TArray<int32> Leftovers;
+
+	/** 배치하지 못한 수량의 합계 */
+	int32 TotalLeftover{0};
+};
+
+/**
+ * 그리드 안에서 스택 하나를 옮기는 이동 정보
+ * 정리(tidy) 결과를 적용하고 서버와 클라이언트 사이에 전달하는 데 사용됩니다
+ */
+USTRUCT()
+struct FInv_GridMove
+{
+	GENERATED_BODY()
+
+	/** 기본 생성자 */
+	FInv_GridMove() {};
+
+	/**
+	 * 파라미터 생성자
+	 * @param From 이동 전 좌상단 인덱스
+	 * @param To 이동 후 좌상단 인덱스
+	 */
+	FInv_GridMove(int32 From, int32 To) : FromIndex(From), ToIndex(To) {};
+
+	/** 이동 전 좌상단 인덱스 */
+	UPROPERTY()
+	int32 FromIndex{INDEX_NONE};
+
+	/** 이동 후 좌상단 인덱스 */
+	UPROPERTY()
+	int32 ToIndex{INDEX_NONE};
+};
+
+/**
+ * 한 카테고리 그리드에 한꺼번에 적용되는 이동 목록
+ * 목록의 모든 이동이 적용되거나, 하나라도 실패하면 아무것도 적용되지 않습니다
+ */
+USTRUCT()
+struct FInv_GridMoveSet
+{
+	GENERATED_BODY()
+
+	/** 이동을 적용할 그리드의 카테고리 */
+	UPROPERTY()
+	EInv_ItemCategory Category{EInv_ItemCategory::None};
+
+	/** 적용할 이동 목록 */
+	UPROPERTY()
+	TArray<FInv_GridMove> Moves;
+};
+
+/**
+ * 아이템 하나가 그리드에 배치된 스택 하나의 위치와 수량
+ * 서버 그리드 모델의 배치를 인벤토리 엔트리로 복제해 클라이언트가 같은 위치에 배치하는 데 사용됩니다
+ */
+USTRUCT()
+struct FInv_GridStack
+{
+	GENERATED_BODY()
+
+	/** 스택의 좌상단 인덱스 */
+	UPROPERTY()
+	int32 Index{INDEX_NONE};
+
+	/** 스택 수량 (스택 불가능 아이템은 0) */
+	UPROPERTY()
+	int32 StackCount{0};
+
+	/** 90도 회전해 배치되었는지 여부 */
+	UPROPERTY()
+	bool bRotated{false};
+
+	bool operator==(const FInv_GridStack& Other) const = default;
+};
+
 
 /**
  * 타일의 사분면 위치를 나타내는 열거형
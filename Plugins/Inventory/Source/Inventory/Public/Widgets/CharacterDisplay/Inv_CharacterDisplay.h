@@ -9,8 +9,9 @@
 /**
  * 인벤토리 UI에서 캐릭터를 3D로 표시하고 회전 가능하도록 하는 위젯
  * 프록시 메시를 드래그하여 캐릭터를 회전시킬 수 있습니다.
+ * 틱을 사용하지 않으며, 드래그 중의 마우스 이동 이벤트로 회전합니다.
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_CharacterDisplay : public UUserWidget
 {
     GENERATED_BODY()
@@ -28,8 +29,8 @@ public:
     /** 위젯 초기화 - 프록시 메시 찾기 */
     virtual void NativeOnInitialized() override;
 
-    /** 틱 - 드래그 중 회전 처리 */
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+    /** 마우스 이동 - 드래그 중 회전 처리 */
+    virtual FReply NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 private:
     /** 현재 드래그 중인지 여부 */
@@ -41,6 +42,6 @@ private:
     /** 현재 마우스 위치 */
     FVector2D CurrentPosition;
 
-    /** 이전 프레임의 마우스 위치 */
+    /** 이전 마우스 이동 이벤트의 마우스 위치 */
     FVector2D LastPosition;
 };
@@ -18,8 +18,26 @@ public:
     virtual void NativeOnInitialized() override;
     virtual void ApplyFunction(FuncType Function) override;
     virtual void Collapse() override;
+    virtual void ForEachLeafWithTag(const FGameplayTag& Tag, TFunctionRef<void(UInv_CompositeBase*)> Function) override;
+    virtual void BeginAssimilation() override;
+    virtual void EndAssimilation() override;
     TArray<UInv_CompositeBase*> GetChildren() { return Children; }
 private:
+    /** 하위 컴포지트까지 내려가 리프 위젯을 FragmentTag별로 인덱스에 추가합니다 */
+    void AddLeavesToIndex(const UInv_Composite* Composite);
+
     UPROPERTY()
     TArray<TObjectPtr<UInv_CompositeBase>> Children;
+
+    /** FragmentTag별 리프 위젯 (하위 컴포지트의 리프 포함). 동화할 때 모든 리프를 순회하지 않도록 합니다 */
+    TMap<FGameplayTag, TArray<TObjectPtr<UInv_CompositeBase>>> LeafIndex;
+
+    /** 이전 동화에서 확장된 리프 위젯 */
+    TSet<TObjectPtr<UInv_CompositeBase>> ExpandedLeaves;
+
+    /** 진행 중인 동화에서 방문한 리프 위젯 */
+    TSet<TObjectPtr<UInv_CompositeBase>> AssimilatedLeaves;
+
+    /** BeginAssimilation과 EndAssimilation 사이인지 여부 */
+    bool bAssimilating{false};
 };
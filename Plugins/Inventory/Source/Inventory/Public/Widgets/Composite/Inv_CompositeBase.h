@@ -23,6 +23,15 @@ public:
 
     using FuncType = TFunction<void(UInv_CompositeBase*)>;
     virtual void ApplyFunction(FuncType Function) {}
+
+    /** FragmentTag가 Tag와 정확히 일치하는 리프 위젯마다 함수를 호출합니다 */
+    virtual void ForEachLeafWithTag(const FGameplayTag& Tag, TFunctionRef<void(UInv_CompositeBase*)> Function) {}
+
+    /** 동화를 시작합니다. 이후 ForEachLeafWithTag로 방문한 리프가 이번 동화에서 확장된 리프로 기록됩니다 */
+    virtual void BeginAssimilation() {}
+
+    /** 동화를 마칩니다. 이전 동화에서 확장되었지만 이번에 방문하지 않은 리프만 축소합니다 */
+    virtual void EndAssimilation() {}
 private:
 
     UPROPERTY(EditAnywhere, Category = "Inventory")
@@ -16,4 +16,5 @@ class INVENTORY_API UInv_Leaf : public UInv_CompositeBase
 
 public:
     virtual void ApplyFunction(FuncType Function) override;
+    virtual void ForEachLeafWithTag(const FGameplayTag& Tag, TFunctionRef<void(UInv_CompositeBase*)> Function) override;
 };
@@ -8,6 +8,7 @@
 
 class UImage;
 class USizeBox;
+struct FStreamableHandle;
 
 /**
  * 컴포지트 위젯 계층 구조에서 이미지를 표시하는 Leaf 위젯 컴포넌트.
@@ -26,10 +27,11 @@ class INVENTORY_API UInv_Leaf_Image : public UInv_Leaf
 public:
     /**
      * 이미지 위젯에 표시될 텍스처를 설정합니다.
+     * 텍스처가 아직 로드되지 않았다면 비동기로 로드하고, 로드되는 동안 이미지를 숨깁니다.
      *
-     * @param Texture 표시할 텍스처. nullptr을 전달하면 이미지가 지워집니다.
+     * @param Texture 표시할 텍스처. 비어있으면 이미지가 지워집니다.
      */
-    void SetImage(UTexture2D* Texture) const;
+    void SetImage(const TSoftObjectPtr<UTexture2D>& Texture);
 
     /**
      * 이미지를 감싸는 SizeBox의 크기를 설정합니다.
@@ -60,5 +62,8 @@ private:
     /** 이미지 위젯을 담는 SizeBox 컨테이너. 위젯 블루프린트에서 바인딩됩니다. */
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<USizeBox> SizeBox_Icon;
+
+    /** 로드 중인 텍스처의 스트리밍 핸들. 다른 텍스처가 설정되면 취소됩니다. */
+    TSharedPtr<FStreamableHandle> IconLoadHandle;
 };
  
\ No newline at end of file
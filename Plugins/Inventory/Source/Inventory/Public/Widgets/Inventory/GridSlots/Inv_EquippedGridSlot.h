@@ -9,6 +9,7 @@
 
 class UOverlay;
 class UInv_EquippedSlottedItem;
+struct FInv_IconBrushCache;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEquippedGridSlotClicked, UInv_EquippedGridSlot*, GridSlot, const FGameplayTag&, EquipmentTypeTag);
 
 /**
@@ -23,7 +24,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEquippedGridSlotClicked, UInv_Equi
  * - 클릭 시 호버 아이템을 해당 슬롯에 장착
  * - 장착된 아이템을 시각적으로 표시 (EquippedSlottedItem 위젯 사용)
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_EquippedGridSlot : public UInv_GridSlot
 {
     GENERATED_BODY()
@@ -61,9 +62,18 @@ public:
 	 * @param Item 장착할 인벤토리 아이템
 	 * @param EquipmentTag 장비 타입 태그 (예: GameItems.Equipment.Weapon)
 	 * @param TileSize 타일 크기 (아이템 위젯의 크기 계산에 사용)
+	 * @param IconBrushCache 아이콘 브러시를 가져올 캐시
 	 * @return 생성된 장착 아이템 위젯
 	 */
-    UInv_EquippedSlottedItem* OnItemEquipped(UInv_InventoryItem* Item, const FGameplayTag& EquipmentTag, float TileSize);
+    UInv_EquippedSlottedItem* OnItemEquipped(UInv_InventoryItem* Item, const FGameplayTag& EquipmentTag, float TileSize, FInv_IconBrushCache& IconBrushCache);
+
+	/**
+	 * 장착된 아이템 위젯의 이미지 브러시를 캐시에서 다시 가져와 설정합니다
+	 * 아이콘이 로드 중이면 자리 표시 브러시가 설정되며, 로드가 끝난 뒤 다시 호출하면 아이콘으로 바뀝니다
+	 * @param TileSize 타일 크기 (브러시 크기 계산에 사용)
+	 * @param IconBrushCache 아이콘 브러시를 가져올 캐시
+	 */
+    void RefreshEquippedItemBrush(float TileSize, FInv_IconBrushCache& IconBrushCache) const;
 
 	/**
 	 * 장착된 아이템 위젯을 설정합니다
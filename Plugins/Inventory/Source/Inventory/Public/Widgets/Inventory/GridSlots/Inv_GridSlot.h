@@ -36,8 +36,9 @@ enum class EInv_GridSlotState : uint8
  * 그리드 슬롯 위젯 클래스
  * 인벤토리 그리드의 개별 슬롯을 나타냅니다
  * 아이템 배치, 마우스 상호작용, 시각적 상태 관리를 담당합니다
+ * 틱을 사용하지 않으므로 브러시가 바뀌지 않는 동안에는 캐시된 그대로 그려집니다
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_GridSlot : public UUserWidget
 {
 	GENERATED_BODY()
@@ -85,24 +86,12 @@ public:
 	 */
 	void SetInventoryItem(UInv_InventoryItem* Item);
 
-	/** 스택 수량을 가져옵니다 */
-	int32 GetStackCount() const { return StackCount; }
-
-	/** 스택 수량을 설정합니다 */
-	void SetStackCount(int32 Count) { StackCount = Count; }
-
 	/** 그리드 인덱스를 가져옵니다 */
 	int32 GetIndex() const { return TileIndex; }
 
 	/** 그리드 인덱스를 설정합니다 */
 	void SetIndex(int32 Index) { TileIndex = Index; }
 
-	/** 아이템의 좌상단 그리드 인덱스를 가져옵니다 (아이템이 여러 슬롯을 차지하는 경우) */
-	int32 GetUpperLeftGridIndex() const { return UpperLeftGridIndex; }
-
-	/** 아이템의 좌상단 그리드 인덱스를 설정합니다 */
-	void SetUpperLeftGridIndex(int32 Index) { UpperLeftGridIndex = Index; }
-
 	/** 이 슬롯이 사용 가능한지 확인합니다 */
 	bool IsAvailable() const { return bAvailable; }
 
@@ -121,6 +110,19 @@ public:
 	/** 비활성화 상태의 텍스처를 설정합니다 */
 	void SetGrayedOutTexture();
 
+	/**
+	 * 슬롯 상태에 맞는 텍스처를 설정합니다
+	 * @param State 적용할 슬롯 상태
+	 */
+	void SetGridSlotState(const EInv_GridSlotState State);
+
+	/**
+	 * 슬롯 상태에 사용하는 브러시를 가져옵니다
+	 * @param State 슬롯 상태
+	 * @return 브러시
+	 */
+	const FSlateBrush& GetBrush(const EInv_GridSlotState State) const;
+
 	void SetItemPopUp(UInv_ItemPopUp* PopUp);
 	UInv_ItemPopUp* GetItemPopUp() const;
 	
@@ -140,12 +142,6 @@ private:
 	/** 이 슬롯의 타일 인덱스 (그리드 내 위치) */
 	int32 TileIndex{INDEX_NONE};
 
-	/** 이 슬롯에 있는 아이템의 스택 수량 */
-	int32 StackCount{0};
-
-	/** 아이템의 좌상단 그리드 인덱스 (다중 슬롯 아이템의 경우) */
-	int32 UpperLeftGridIndex{INDEX_NONE};
-
 	/** 이 슬롯이 사용 가능한지 여부 (아이템을 놓을 수 있는지) */
 	bool bAvailable{true};
 	
@@ -177,5 +173,14 @@ private:
 	/** 그리드 슬롯의 현재 시각적 상태 */
 	EInv_GridSlotState GridSlotState;
 
+	/** 현재 상태의 브러시가 이미지에 적용되었는지 여부 (처음에는 상태와 관계없이 브러시를 설정합니다) */
+	bool bGridSlotBrushApplied{false};
+
+	/**
+	 * 슬롯 상태를 바꾸고 상태가 달라졌을 때만 브러시를 적용합니다
+	 * @param State 적용할 슬롯 상태
+	 */
+	void ApplyGridSlotState(const EInv_GridSlotState State);
+
 	
 };
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Blueprint/UserWidget.h"
+#include "Widgets/Pool/Inv_PooledWidget.h"
 #include "Inv_HoverItem.generated.h"
 
 class UInv_InventoryItem;
@@ -16,12 +17,18 @@ class UImage;
  * 드래그 중인 아이템을 마우스 커서를 따라다니며 표시합니다
  * 아이템 아이콘, 스택 개수, 그리드 차원 등의 정보를 표시합니다
  */
-UCLASS()
-class INVENTORY_API UInv_HoverItem : public UUserWidget
+UCLASS(meta = (DisableNativeTick))
+class INVENTORY_API UInv_HoverItem : public UUserWidget, public IInv_PooledWidget
 {
     GENERATED_BODY()
 
 public:
+    /**
+     * 위젯 풀에 반환될 때 호출됩니다
+     * 아이템, 스택, 방향, 아이콘을 비어있는 상태로 되돌립니다
+     */
+    virtual void OnReleasedToPool_Implementation() override;
+
     /**
      * 아이템 이미지 브러시를 설정합니다
      * @param Brush 적용할 슬레이트 브러시
@@ -71,17 +78,29 @@ public:
     void SetPreviousGridIndex(int32 Index) { PreviousGridIndex = Index; }
 
     /**
-     * 그리드 차원을 가져옵니다
+     * 현재 방향이 반영된 그리드 차원을 가져옵니다
      * @return 그리드 차원 (너비, 높이)
      */
-    FIntPoint GetGridDimensions() const { return GridDimensions; }
+    FIntPoint GetGridDimensions() const { return bRotated ? FIntPoint(GridDimensions.Y, GridDimensions.X) : GridDimensions; }
 
     /**
-     * 그리드 차원을 설정합니다
+     * 회전하지 않은 방향의 그리드 차원을 설정합니다
      * @param Dimensions 그리드 차원 (너비, 높이)
      */
     void SetGridDimensions(const FIntPoint& Dimensions) { GridDimensions = Dimensions; }
 
+    /**
+     * 아이템이 90도 회전해 있는지 확인합니다
+     * @return 회전해 있으면 true
+     */
+    bool IsRotated() const { return bRotated; }
+
+    /**
+     * 아이템의 방향을 설정하고 아이콘을 회전합니다
+     * @param bInRotated 90도 회전할지 여부
+     */
+    void SetRotated(bool bInRotated);
+
     /**
      * 인벤토리 아이템을 가져옵니다
      * @return 인벤토리 아이템 포인터
@@ -107,9 +126,12 @@ private:
     /** 아이템의 이전 그리드 인덱스 (픽업 전 위치) */
     int32 PreviousGridIndex;
 
-    /** 아이템의 그리드 차원 (너비, 높이) */
+    /** 회전하지 않은 방향의 그리드 차원 (너비, 높이) */
     FIntPoint GridDimensions;
 
+    /** 아이템이 90도 회전해 있는지 여부 */
+    bool bRotated{false};
+
     /** 드래그 중인 인벤토리 아이템에 대한 약한 참조 */
     TWeakObjectPtr<UInv_InventoryItem> InventoryItem;
 
@@ -56,6 +56,12 @@ public:
 	 */
 	virtual UInv_HoverItem* GetHoverItem() const { return nullptr; }
 
+	/**
+	 * 현재 들고 있는 호버 아이템을 90도 회전합니다
+	 * 파생 클래스에서 오버라이드하여 호버 아이템을 가진 그리드에 전달합니다
+	 */
+	virtual void RotateHoverItem() {}
+
 	/**
 	 * 그리드의 타일 크기를 가져옵니다
 	 * 타일 크기는 그리드의 각 셀이 차지하는 픽셀 단위 크기입니다
@@ -25,7 +25,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEquippedSlottedItemClicked, class U
  * - UInv_EquippedGridSlot의 Overlay_Root에 자식으로 추가됨
  * - UInv_SpatialInventory에서 장비 장착/해제 시 생성/제거됨
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_EquippedSlottedItem : public UInv_SlottedItem
 {
     GENERATED_BODY()
@@ -41,6 +41,12 @@ public:
 	 */
     virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
+	/**
+	 * 위젯 풀에 반환될 때 호출됩니다
+	 * 슬롯 아이템의 초기화에 더해 장비 타입 태그와 장착 아이템 클릭 바인딩을 초기화합니다
+	 */
+    virtual void OnReleasedToPool_Implementation() override;
+
 	/**
 	 * 장비 타입 태그를 설정합니다
 	 * 이 아이템이 어떤 종류의 장비인지를 나타냅니다 (무기, 투구, 갑옷 등)
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Widgets/Pool/Inv_PooledWidget.h"
 #include "Inv_SlottedItem.generated.h"
 
 class UTextBlock;
@@ -20,9 +21,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSlottedItemCliced, int32, GridInde
  * 슬롯 아이템 위젯 클래스
  * 그리드에 배치된 아이템을 표시합니다
  * 아이템 아이콘, 스택 개수, 클릭 이벤트 등을 관리합니다
+ * 틱을 사용하지 않으며, 아이콘이나 스택 개수가 바뀔 때만 다시 그려집니다
  */
-UCLASS()
-class INVENTORY_API UInv_SlottedItem : public UUserWidget
+UCLASS(meta = (DisableNativeTick))
+class INVENTORY_API UInv_SlottedItem : public UUserWidget, public IInv_PooledWidget
 {
 	GENERATED_BODY()
 
@@ -49,6 +51,13 @@ public:
 	 * @param MouseEvent 마우스 이벤트 정보
 	 */
 	virtual void NativeOnMouseLeave(const FPointerEvent& MouseEvent) override;
+
+	/**
+	 * 위젯 풀에 반환될 때 호출됩니다
+	 * 아이템 참조, 아이콘, 스택 표시와 클릭 이벤트 바인딩을 초기화합니다 (다른 그리드가 재사용할 수 있음)
+	 */
+	virtual void OnReleasedToPool_Implementation() override;
+
 	/** 아이템이 스택 가능한지 확인합니다 */
 	bool IsStackable() const { return bIsStackable; }
 
@@ -104,7 +113,7 @@ private:
 	TObjectPtr<UTextBlock> Text_StackCount;
 
 	/** 이 아이템이 배치된 그리드 인덱스 */
-	int32 GridIndex;
+	int32 GridIndex{INDEX_NONE};
 
 	/** 아이템의 그리드 차원 (너비, 높이) */
 	FIntPoint GridDimensions;
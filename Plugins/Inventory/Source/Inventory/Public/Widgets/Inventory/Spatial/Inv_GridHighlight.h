@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "Widgets/Inventory/Spatial/SInv_GridHighlight.h"
+#include "Inv_GridHighlight.generated.h"
+
+/**
+ * SInv_GridHighlight를 감싸는 UMG 위젯
+ * 정적 레이어를 리테이너에 캐시할 때 인벤토리 그리드가 셀 상태 대신 이 레이어로 하이라이트를 표시합니다
+ * 셀 좌표는 모두 보이는 영역 기준입니다
+ */
+UCLASS()
+class INVENTORY_API UInv_GridHighlight : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * 타일 크기와 셀 브러시를 설정하고 하이라이트를 비웁니다
+	 * @param InTileSize 타일 크기 (픽셀)
+	 * @param BrushSource 셀 브러시를 가져올 그리드 슬롯 (보통 그리드 슬롯 클래스의 기본 객체)
+	 */
+	void InitializeHighlight(const float InTileSize, const UInv_GridSlot* BrushSource);
+
+	/**
+	 * 하이라이트 영역과 상태를 설정합니다 (바뀌었을 때만 다시 그림)
+	 * @param CellRect 하이라이트할 셀 영역 (보이는 영역 기준)
+	 * @param State 영역에 그릴 슬롯 상태
+	 */
+	void SetHighlight(const FIntRect& CellRect, const EInv_GridSlotState State);
+
+	/** 하이라이트를 지웁니다 */
+	void ClearHighlight();
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+private:
+
+	/** 상태가 바뀌었으므로 다시 그리도록 요청합니다 */
+	void InvalidateHighlight() const;
+
+	/** Slate 위젯과 공유하는 하이라이트 상태 */
+	TSharedPtr<FInv_GridHighlightData> HighlightData{MakeShared<FInv_GridHighlightData>()};
+
+	/** 생성된 Slate 위젯 */
+	TSharedPtr<SInv_GridHighlight> MyGridHighlight;
+};
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "Widgets/Inventory/Spatial/SInv_GridRenderer.h"
+#include "Inv_GridRenderer.generated.h"
+
+/**
+ * SInv_GridRenderer를 감싸는 UMG 위젯
+ * 인벤토리 그리드가 슬롯 위젯 대신 사용하며, 셀 상태와 아이템 정보를 보관했다가 Slate 위젯이 그리도록 합니다
+ * 셀 인덱스는 모두 보이는 영역 기준입니다
+ */
+UCLASS()
+class INVENTORY_API UInv_GridRenderer : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * 그릴 그리드의 크기와 셀 브러시를 설정하고 모든 셀을 비어있는 상태로 초기화합니다
+	 * @param InColumns 열 수
+	 * @param InRows 그릴 행 수
+	 * @param InTileSize 타일 크기 (픽셀)
+	 * @param BrushSource 셀 브러시를 가져올 그리드 슬롯 (보통 그리드 슬롯 클래스의 기본 객체)
+	 * @param StackCountFont 스택 수량 텍스트 폰트
+	 */
+	void InitializeGrid(const int32 InColumns, const int32 InRows, const float InTileSize, const UInv_GridSlot* BrushSource, const FSlateFontInfo& StackCountFont);
+
+	/**
+	 * 셀의 슬롯 상태를 설정합니다
+	 * @param CellIndex 보이는 영역 기준 셀 인덱스
+	 * @param State 슬롯 상태
+	 */
+	void SetCellState(const int32 CellIndex, const EInv_GridSlotState State);
+
+	/**
+	 * 아이템을 추가하거나 같은 위치의 아이템을 교체합니다
+	 * @param UpperLeftIndex 아이템의 좌상단 그리드 인덱스 (식별용)
+	 * @param Item 그릴 아이템 정보
+	 */
+	void AddItem(const int32 UpperLeftIndex, const FInv_GridRenderItem& Item);
+
+	/**
+	 * 아이템을 제거합니다
+	 * @param UpperLeftIndex 아이템의 좌상단 그리드 인덱스
+	 */
+	void RemoveItem(const int32 UpperLeftIndex);
+
+	/**
+	 * 아이템의 스택 수량 표시를 바꿉니다
+	 * @param UpperLeftIndex 아이템의 좌상단 그리드 인덱스
+	 * @param StackCount 표시할 스택 수량
+	 */
+	void SetItemStackCount(const int32 UpperLeftIndex, const int32 StackCount);
+
+	/** 모든 아이템을 제거합니다 */
+	void ClearItems();
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+	/** 셀이 클릭되었을 때 호출됩니다 */
+	FInv_GridCellClicked OnCellClicked;
+
+	/** 마우스가 올라간 셀이 바뀌었을 때 호출됩니다 */
+	FInv_GridHoveredCellChanged OnHoveredCellChanged;
+
+protected:
+
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+private:
+
+	/** 상태가 바뀌었으므로 다시 그리도록 요청합니다 */
+	void InvalidateRenderer() const;
+
+	void HandleCellClicked(int32 CellIndex, const FPointerEvent& MouseEvent) const;
+	void HandleHoveredCellChanged(int32 PreviousCellIndex, int32 CellIndex, const FPointerEvent& MouseEvent) const;
+
+	/** Slate 위젯과 공유하는 그리드 상태 */
+	TSharedPtr<FInv_GridRenderData> RenderData{MakeShared<FInv_GridRenderData>()};
+
+	/** 생성된 Slate 위젯 */
+	TSharedPtr<SInv_GridRenderer> MyGridRenderer;
+};
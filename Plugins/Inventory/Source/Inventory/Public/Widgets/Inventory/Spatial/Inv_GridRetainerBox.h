@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/RetainerBox.h"
+#include "Inv_GridRetainerBox.generated.h"
+
+/**
+ * 인벤토리 그리드의 정적 레이어를 렌더 타깃에 캐시하는 리테이너 박스
+ * 매 프레임(페이즈)마다 다시 그리는 기본 설정 대신, 자식 위젯이 무효화되었을 때만 다시 그립니다
+ */
+UCLASS()
+class INVENTORY_API UInv_GridRetainerBox : public URetainerBox
+{
+	GENERATED_BODY()
+
+public:
+
+	UInv_GridRetainerBox();
+};
@@ -6,9 +6,11 @@
 #include "Blueprint/UserWidget.h"
 #include "Items/Inv_InventoryItem.h"
 #include "Types/Inv_GridTypes.h"
+#include "Widgets/Utils/Inv_IconBrushCache.h"
 #include "Widgets/Inventory/SlottedItems/Inv_SlottedItem.h"
 #include "Inv_InventoryGrid.generated.h"
 
+struct FInv_GridModel;
 class UInv_ItemPopUp;
 enum class EInv_GridSlotState : uint8;
 class UInv_HoverItem;
@@ -19,14 +21,20 @@ class UInv_ItemComponent;
 class UInv_InventoryComponent;
 class UCanvasPanel;
 class UInv_GridSlot;
+class UInv_GridRenderer;
+class UInv_GridHighlight;
+class UContentWidget;
+class UInvalidationBox;
 
 /**
  * 그리드 기반 인벤토리 위젯 클래스
  * 그리드 슬롯과 슬롯에 배치된 아이템들을 관리합니다
  * 카테고리별로 필터링되며, 아이템 배치 가능 여부 검사, 드래그 앤 드롭 등의 기능을 제공합니다
  * 공간 기반 인벤토리 시스템의 핵심 클래스입니다
+ * 틱을 사용하지 않으며, 호버 위치는 마우스 이벤트와 그리드 상태 변경 시에만 갱신합니다
+ * 셀과 아이템은 캐시되는 정적 레이어에 두어, 아무것도 바뀌지 않는 프레임에는 다시 그리지 않습니다
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_InventoryGrid : public UUserWidget
 {
 	GENERATED_BODY()
@@ -39,12 +47,41 @@ public:
 	virtual void NativeOnInitialized() override;
 
 	/**
-	 * 매 프레임 호출됩니다
-	 * 마우스 위치를 추적하고 호버 아이템을 업데이트합니다
+	 * 소멸 시 뷰포트 크기 변경 이벤트 바인딩을 해제합니다
+	 */
+	virtual void BeginDestroy() override;
+
+	/**
+	 * 아이콘 브러시 캐시의 텍스처 참조를 GC에 알립니다
+	 * @param InThis 이 그리드
+	 * @param Collector 레퍼런스 콜렉터
+	 */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/**
+	 * 마우스가 움직였을 때 호출됩니다
+	 * 캔버스 안의 마우스 위치로 타일 파라미터를 갱신하고 호버 아이템의 하이라이트를 업데이트합니다
+	 * @param MyGeometry 위젯의 지오메트리 정보
+	 * @param MouseEvent 마우스 이벤트
+	 * @return 처리하지 않음 (상위 위젯도 마우스 이동을 받도록)
+	 */
+	virtual FReply NativeOnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	/**
+	 * 마우스가 위젯을 벗어났을 때 호출됩니다
+	 * 하이라이트를 해제합니다
+	 * @param MouseEvent 마우스 이벤트
+	 */
+	virtual void NativeOnMouseLeave(const FPointerEvent& MouseEvent) override;
+
+	/**
+	 * 마우스 휠 입력 시 호출됩니다
+	 * 표시 행 수가 그리드보다 적으면 보이는 영역을 한 행씩 스크롤합니다
 	 * @param MyGeometry 위젯의 지오메트리 정보
-	 * @param InDeltaTime 이전 프레임으로부터의 경과 시간
+	 * @param MouseEvent 마우스 이벤트
+	 * @return 스크롤했으면 Handled
 	 */
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
 	/**
 	 * 이 그리드가 표시하는 아이템 카테고리를 가져옵니다
@@ -123,167 +160,191 @@ public:
 	 * @param InventoryItem 인벤토리 아이템
 	 */
 	void AssignHoverItem(UInv_InventoryItem* InventoryItem);
+
+	/**
+	 * 호버 아이템을 90도 회전합니다
+	 * 회전할 수 없는 아이템이면 무시합니다
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void RotateHoverItem();
+
+	/**
+	 * 보이는 영역의 첫 번째 행을 바꿉니다
+	 * 보이는 슬롯 위젯의 인덱스를 다시 지정하고, 보이는 영역과 겹치는 아이템 위젯만 다시 배치합니다
+	 * @param Row 보이는 영역의 첫 번째 행 (범위를 벗어나면 보정됨)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void ScrollToRow(int32 Row);
+
+	/**
+	 * 보이는 영역의 첫 번째 행을 가져옵니다
+	 * @return 첫 번째 행
+	 */
+	int32 GetFirstVisibleRow() const { return FirstVisibleRow; }
+
+	/**
+	 * 그리드 슬롯 구성을 시작합니다 (탭이 처음 표시될 때 호출)
+	 * 슬롯은 프레임마다 ConstructionBudgetMs 안에서 나누어 생성하며, 끝나면 그리드 모델의 아이템을 그립니다
+	 * 이미 시작했다면 무시합니다
+	 */
+	void RequestConstruction();
+
+	/**
+	 * 그리드 구성이 끝났는지 확인합니다
+	 * @return 슬롯 생성과 아이템 배치가 끝났으면 true
+	 */
+	bool IsGridConstructed() const { return bGridConstructed; }
 	
 	void OnHide();
 	
 private:
 
+	/**
+	 * 그리드 캔버스 안에 셀 레이어, 하이라이트 레이어, 아이템 레이어를 만듭니다
+	 * 셀과 아이템 레이어는 무효화될 때만 다시 그리는 캐시 컨테이너 안에 두고, bRetainStaticLayer이면 셀 레이어를 렌더 타깃에 캐시합니다
+	 */
+	void ConstructLayers();
+
+	/**
+	 * 위젯을 그리드 캔버스 전체를 덮도록 추가합니다
+	 * @param Layer 추가할 레이어 위젯
+	 */
+	void AddFullSizeLayer(UWidget* Layer);
+
 	/**
 	 * 그리드를 구성합니다
-	 * 지정된 행과 열 수에 따라 그리드 슬롯들을 생성하고 캔버스에 배치합니다
+	 * 그리드 크기를 모델에 맞춘 뒤 배치 렌더러를 만들거나 그리드 슬롯 생성을 시작합니다
 	 */
 	void ConstructGrid();
-	
+
 	/**
-	 * 인벤토리 아이템을 위한 공간이 있는지 확인합니다
-	 * @param Item 확인할 인벤토리 아이템
-	 * @return 슬롯 사용 가능 여부 결과
+	 * 이번 프레임의 예산 안에서 남은 그리드 슬롯들을 생성하고 캔버스에 배치합니다
+	 * 예산을 넘기면 다음 프레임에 이어서 생성합니다
 	 */
-	FInv_SlotAvailabilityResult HasRoomForItem(const UInv_InventoryItem* Item, const int32 StackAmountOverride = -1);
+	void ContinueGridConstruction();
 
 	/**
-	 * 아이템 매니페스트를 위한 공간이 있는지 확인합니다
-	 * @param Manifest 확인할 아이템 매니페스트
-	 * @return 슬롯 사용 가능 여부 결과
+	 * 그리드 구성을 마치고 그리드 모델의 아이템들을 그립니다
 	 */
-	FInv_SlotAvailabilityResult HasRoomForItem(const FInv_ItemManifest& Manifest, const int32 StackAmountOverride = -1);
+	void FinishGridConstruction();
 
 	/**
-	 * 결과에 따라 지정된 인덱스에 아이템을 추가합니다
-	 * @param Result 슬롯 사용 가능 여부 결과
-	 * @param NewItem 추가할 새 아이템
+	 * 한 번에 화면에 표시하는 행 수를 가져옵니다
+	 * @return VisibleRows가 0이거나 그리드보다 크면 전체 행 수
 	 */
-	void AddItemToIndices(const FInv_SlotAvailabilityResult& Result, UInv_InventoryItem* NewItem);
+	int32 GetNumVisibleRows() const;
+
 	/**
-	 * 슬롯에 배치될 아이템 위젯을 생성합니다
-	 * @param Item 인벤토리 아이템
-	 * @param bStackable 스택 가능 여부
-	 * @param StackAmount 스택 수량
-	 * @param GridFragment 그리드 프래그먼트
-	 * @param ImageFragment 이미지 프래그먼트
+	 * 그리드 인덱스가 그리드 범위 내에 있는지 확인합니다
 	 * @param Index 그리드 인덱스
-	 * @return 생성된 슬롯 아이템 위젯
+	 * @return 유효한 인덱스면 true
 	 */
-	UInv_SlottedItem* CreateSlottedItem(UInv_InventoryItem* Item,
-		const bool bStackable,
-		const int32 StackAmount,
-		const FInv_GridFragment* GridFragment,
-		const FInv_ImageFragment* ImageFragment,
-		const int32 Index);
+	bool IsValidGridIndex(const int32 Index) const;
 
 	/**
-	 * 슬롯 아이템을 캔버스에 추가합니다
+	 * 그리드 인덱스의 셀을 표시하는 슬롯 위젯을 가져옵니다
 	 * @param Index 그리드 인덱스
-	 * @param GridFragment 그리드 프래그먼트 (크기 정보)
-	 * @param SlottedItem 추가할 슬롯 아이템 위젯
+	 * @return 슬롯 위젯, 보이는 영역 밖이면 nullptr
 	 */
-	void AddSlottedItemToCanvas(const int32 Index, const FInv_GridFragment* GridFragment, UInv_SlottedItem* SlottedItem);
+	UInv_GridSlot* GetGridSlot(const int32 Index) const;
 
 	/**
-	 * 그리드 슬롯들을 업데이트합니다 (점유 상태 등)
-	 * @param NewItem 새로 추가된 아이템
+	 * 사각형 영역 중 보이는 셀들에 대해 함수를 실행합니다
+	 * 그리드와 보이는 영역을 벗어난 셀은 건너뜁니다
 	 * @param Index 시작 인덱스
-	 * @param bStackableItem 스택 가능 여부
-	 * @param StackAmount 스택 수량
+	 * @param Dimensions 영역 크기
+	 * @param Function 셀의 그리드 인덱스마다 실행할 함수
 	 */
-	void UpdateGridSlots(UInv_InventoryItem* NewItem, const int32 Index, bool bStackableItem, const int32 StackAmount);
+	void ForEachVisibleCell(const int32 Index, const FIntPoint& Dimensions, const TFunctionRef<void(int32)> Function) const;
 
 	/**
-	 * 인덱스가 이미 점유되었는지 확인합니다
-	 * @param CheckedIndices 확인된 인덱스 집합
-	 * @param Index 확인할 인덱스
-	 * @return 점유된 경우 true
+	 * 보이는 셀의 표시 상태를 설정합니다
+	 * 배치 렌더러를 사용하면 렌더러의 셀을, 아니면 슬롯 위젯의 텍스처를 바꿉니다
+	 * @param Index 그리드 인덱스
+	 * @param State 표시할 상태
 	 */
-	bool IsIndexClaimed(const TSet<int32>& CheckedIndices, const int32 Index) const;
+	void SetCellState(const int32 Index, const EInv_GridSlotState State);
 
 	/**
-	 * 지정된 인덱스에 아이템을 배치할 공간이 있는지 확인합니다
-	 * @param GridSlot 확인할 그리드 슬롯
-	 * @param Dimensions 아이템의 크기 (너비, 높이)
-	 * @param CheckedIndices 이미 확인된 인덱스 집합
-	 * @param OutTentativelyClaimed 임시로 점유된 인덱스들을 반환할 출력 매개변수
-	 * @param ItemType 아이템 타입 GameplayTag
-	 * @param MaxStackSize 최대 스택 크기
-	 * @return 공간이 있는 경우 true
-	 */
-	bool HasRoomAtIndex(const UInv_GridSlot* GridSlot,
-		const FIntPoint& Dimensions,
-		const TSet<int32>& CheckedIndices,
-		TSet<int32>& OutTentativelyClaimed,
-		const FGameplayTag& ItemType,
-		const int32 MaxStackSize);
-
-	/**
-	 * 슬롯 제약 조건을 확인합니다 (스택 가능 여부, 타입 일치 등)
-	 * @param GridSlot 주 그리드 슬롯
-	 * @param SubGridSlot 확인할 하위 그리드 슬롯
-	 * @param CheckedIndices 이미 확인된 인덱스 집합
-	 * @param OutTentativelyClaimed 임시로 점유된 인덱스들
-	 * @param ItemType 아이템 타입 GameplayTag
-	 * @param MaxStackSize 최대 스택 크기
-	 * @return 제약 조건을 만족하는 경우 true
+	 * 배치된 아이템이 보이는 영역과 겹치는지 확인합니다
+	 * @param Index 아이템의 좌상단 인덱스
+	 * @param Dimensions 아이템 크기
+	 * @return 한 행이라도 보이면 true
 	 */
-	bool CheckSlotConstraints(const UInv_GridSlot* GridSlot,
-		const UInv_GridSlot* SubGridSlot,
-		const TSet<int32>& CheckedIndices,
-		TSet<int32>& OutTentativelyClaimed,
-		const FGameplayTag& ItemType,
-		const int32 MaxStackSize) const;
+	bool IsAreaVisible(const int32 Index, const FIntPoint& Dimensions) const;
 
 	/**
-	 * 그리드 슬롯에 유효한 아이템이 있는지 확인합니다
-	 * @param GridSlot 확인할 그리드 슬롯
-	 * @return 유효한 아이템이 있는 경우 true
+	 * 보이는 영역을 그리드 모델에 맞춰 다시 그립니다
+	 * 슬롯 위젯의 인덱스와 점유 표시를 갱신하고, 아이템 위젯을 모두 회수한 뒤 보이는 아이템만 다시 배치합니다
 	 */
-	bool HasValidItem(const UInv_GridSlot* GridSlot) const;
+	void RefreshVisibleWindow();
 
 	/**
-	 * SubGridSlot이 GridSlot의 좌상단 슬롯인지 확인합니다
-	 * @param GridSlot 주 그리드 슬롯
-	 * @param SubGridSlot 확인할 하위 슬롯
-	 * @return 좌상단 슬롯인 경우 true
+	 * 위젯 풀에서 슬롯 아이템 위젯을 꺼내고 클릭 이벤트를 바인딩합니다
+	 * @return 슬롯 아이템 위젯
 	 */
-	bool IsUpperLeftSlot(const UInv_GridSlot* GridSlot, const UInv_GridSlot* SubGridSlot) const;
+	UInv_SlottedItem* AcquireSlottedItem();
 
 	/**
-	 * 아이템 타입이 일치하는지 확인합니다
-	 * @param SubItem 확인할 인벤토리 아이템
-	 * @param ItemType 비교할 아이템 타입 GameplayTag
-	 * @return 타입이 일치하는 경우 true
+	 * 슬롯 아이템 위젯을 캔버스에서 제거하고 위젯 풀에 반환합니다
+	 * @param SlottedItem 회수할 슬롯 아이템 위젯
 	 */
-	bool DoesItemTypeMatch(const UInv_InventoryItem* SubItem, const FGameplayTag& ItemType) const;
+	void ReleaseSlottedItem(UInv_SlottedItem* SlottedItem);
 
 	/**
-	 * 아이템이 그리드 경계 내에 있는지 확인합니다
-	 * @param StartIndex 시작 인덱스
-	 * @param ItemDimensions 아이템 크기
-	 * @return 경계 내에 있는 경우 true
+	 * 아이템 위젯이 보이는 경우 스택 수량 표시를 업데이트합니다
+	 * @param Index 아이템의 좌상단 인덱스
+	 * @param StackCount 표시할 스택 수량
 	 */
-	bool IsInGridBounds(const int32 StartIndex, const FIntPoint& ItemDimensions) const;
-
+	void UpdateSlottedItemStackCount(const int32 Index, const int32 StackCount);
+	
 	/**
-	 * 슬롯에 채울 수 있는 수량을 결정합니다
+	 * 슬롯에 배치될 아이템 위젯을 생성합니다
+	 * @param Item 인벤토리 아이템
 	 * @param bStackable 스택 가능 여부
-	 * @param MaxStackSize 최대 스택 크기
-	 * @param AmountToFill 채워야 할 총 수량
-	 * @param GridSlot 대상 그리드 슬롯
-	 * @return 슬롯에 채울 수량
+	 * @param StackAmount 스택 수량
+	 * @param GridFragment 그리드 프래그먼트
+	 * @param ImageFragment 이미지 프래그먼트
+	 * @param Index 그리드 인덱스
+	 * @return 생성된 슬롯 아이템 위젯
+	 */
+	UInv_SlottedItem* CreateSlottedItem(UInv_InventoryItem* Item,
+		const bool bStackable,
+		const int32 StackAmount,
+		const FInv_GridFragment* GridFragment,
+		const FInv_ImageFragment* ImageFragment,
+		const int32 Index);
+
+	/**
+	 * 슬롯 아이템을 캔버스에 추가합니다
+	 * @param Index 그리드 인덱스
+	 * @param GridFragment 그리드 프래그먼트 (크기 정보)
+	 * @param SlottedItem 추가할 슬롯 아이템 위젯
+	 * @param bRotated 아이템이 90도 회전해 배치되어 있는지 여부
 	 */
-	int32 DetermineFillAmountForSlot(const bool bStackable, const int32 MaxStackSize, const int32 AmountToFill, const UInv_GridSlot* GridSlot) const;
+	void AddSlottedItemToCanvas(const int32 Index, const FInv_GridFragment* GridFragment, UInv_SlottedItem* SlottedItem, const bool bRotated);
 
 	/**
-	 * 그리드 슬롯의 현재 스택 수량을 가져옵니다
-	 * @param GridSlot 확인할 그리드 슬롯
-	 * @return 스택 수량
+	 * 아이템을 그릴 캔버스 위치를 계산합니다 (보이는 영역 기준, 패딩 포함)
+	 * @param Index 아이템의 좌상단 인덱스
+	 * @param GridFragment 그리드 프래그먼트 (패딩 정보)
+	 * @return 캔버스 위치 (픽셀)
 	 */
-	int32 GetStackAmount(const UInv_GridSlot* GridSlot) const;
+	FVector2D GetItemDrawPosition(const int32 Index, const FInv_GridFragment* GridFragment) const;
 
 	/**
-	 * 아이템 매니페스트에서 아이템의 크기를 가져옵니다
-	 * @param Manifest 아이템 매니페스트
-	 * @return 아이템 크기 (너비, 높이)
+	 * 아이템이 차지하는 그리드 슬롯들을 점유 상태로 표시합니다
+	 * 점유 정보 자체는 그리드 모델에 있으며, 이 함수는 화면만 갱신합니다
+	 * @param Index 시작 인덱스
+	 * @param Dimensions 아이템 크기
 	 */
-	FIntPoint GetItemDimensions(const FInv_ItemManifest& Manifest) const;
+	void UpdateGridSlots(const int32 Index, const FIntPoint& Dimensions);
+
+	/**
+	 * 인벤토리 컴포넌트가 소유한 이 그리드 카테고리의 모델을 가져옵니다
+	 * @return 그리드 모델
+	 */
+	const FInv_GridModel& GetGridModel() const;
 
 	/**
 	 * 아이템이 이 그리드의 카테고리와 일치하는지 확인합니다
@@ -295,9 +356,10 @@ private:
 	/**
 	 * 그리드 프래그먼트로부터 그릴 크기를 계산합니다
 	 * @param GridFragment 그리드 프래그먼트
+	 * @param bRotated 90도 회전한 방향의 크기를 계산할지 여부
 	 * @return 그릴 크기 (픽셀)
 	 */
-	FVector2D GetDrawSize(const FInv_GridFragment* GridFragment) const;
+	FVector2D GetDrawSize(const FInv_GridFragment* GridFragment, const bool bRotated = false) const;
 
 	/**
 	 * 슬롯 아이템의 이미지를 설정합니다
@@ -307,8 +369,42 @@ private:
 	 */
 	void SetSlottedItemImage(const UInv_SlottedItem* SlottedItem, const FInv_GridFragment* GridFragment, const FInv_ImageFragment* ImageFragment) const;
 
+	/**
+	 * 아이템 아이콘 브러시를 캐시에서 가져옵니다 (회전하지 않은 방향의 크기)
+	 * @param GridFragment 그리드 프래그먼트
+	 * @param ImageFragment 이미지 프래그먼트
+	 * @param Scale 추가로 곱할 스케일 (호버 아이템은 뷰포트 스케일)
+	 * @return 캐시된 아이콘 브러시 (캐시가 비워질 때까지 유효)
+	 */
+	const FSlateBrush& GetIconBrush(const FInv_GridFragment* GridFragment, const FInv_ImageFragment* ImageFragment, const float Scale = 1.f) const;
+
+	/**
+	 * 뷰포트 크기가 바뀌었을 때 호출됩니다
+	 * DPI 스케일이 바뀌었으면 아이콘 브러시 캐시를 비우고 아이템과 호버 아이템의 브러시를 다시 설정합니다
+	 * @param Viewport 크기가 바뀐 뷰포트
+	 * @param Unused 사용하지 않음
+	 */
+	void OnViewportResized(FViewport* Viewport, uint32 Unused);
+
+	/**
+	 * 아이콘 브러시 캐시에서 아이콘 로드가 끝났을 때 호출됩니다
+	 * 같은 프레임의 여러 로드를 모아 다음 틱에 한 번만 다시 그립니다
+	 */
+	void OnIconLoaded();
+
+	/**
+	 * 로드가 끝난 아이콘으로 보이는 아이템과 호버 아이템의 브러시를 다시 설정합니다
+	 */
+	void RefreshLoadedIcons();
+
+	/**
+	 * 호버 아이템의 브러시를 캐시에서 다시 가져와 설정합니다 (뷰포트 스케일 적용)
+	 */
+	void RefreshHoverItemBrush();
+
 	/**
 	 * 지정된 인덱스에 아이템을 추가합니다
+	 * 아이템이 보이는 영역 밖에 있으면 위젯을 만들지 않습니다 (스크롤될 때 만들어짐)
 	 * @param Item 추가할 인벤토리 아이템
 	 * @param Index 그리드 인덱스
 	 * @param bStackable 스택 가능 여부
@@ -366,6 +462,12 @@ private:
 	 */
 	void UpdateTileParameters(const FVector2D& CanvasPosition, const FVector2D& MousePosition);
 
+	/**
+	 * 마지막 마우스 위치에서 호버 위치 검사와 하이라이트를 다시 계산합니다
+	 * 마우스가 움직이지 않아도 호버 아이템, 방향, 그리드 내용이 바뀌면 호출합니다 (바뀐 것이 없으면 메모이즈된 결과를 사용)
+	 */
+	void RefreshHoverQuery();
+
 	/**
 	 * 마우스가 호버하고 있는 타일의 좌표를 계산합니다
 	 * @param CanvasPosition 캔버스 위치
@@ -430,8 +532,22 @@ private:
 	 */
 	void ChangeHoverType(const int32 Index, const FIntPoint& Dimensions, EInv_GridSlotState GridSlotState);
 
+	/**
+	 * 하이라이트를 새 영역과 상태로 옮깁니다
+	 * 이전 영역과 새 영역의 차이만 갱신합니다: 새 영역 밖의 이전 셀은 점유 상태로 되돌리고,
+	 * 겹치는 셀은 상태가 같고 그 사이 다른 갱신이 없었다면 건너뜁니다
+	 * @param Index 새 영역의 시작 인덱스
+	 * @param Dimensions 새 영역의 차원 (너비, 높이)
+	 * @param GridSlotState 새 영역에 적용할 그리드 슬롯 상태
+	 */
+	void UpdateHighlight(const int32 Index, const FIntPoint& Dimensions, const EInv_GridSlotState GridSlotState);
+
+	/** 마지막 하이라이트를 해제하고 하이라이트된 영역이 없는 상태로 만듭니다 */
+	void ClearHighlight();
+
 	/**
 	 * 지정된 인덱스에 아이템을 놓습니다
+	 * 그리드 모델에 배치할 수 없으면 호버 아이템을 그대로 유지합니다
 	 * @param Index 그리드 인덱스
 	 */
 	void PutDownOnIndex(const int32 Index);
@@ -460,6 +576,7 @@ private:
 
 	/**
 	 * 호버 아이템과 클릭한 아이템의 위치를 교환합니다
+	 * 드롭 위치에 클릭한 아이템 외의 아이템이 겹치면 교환하지 않습니다
 	 * @param ClickedInventoryItem 클릭한 인벤토리 아이템
 	 * @param GridIndex 클릭한 그리드 인덱스
 	 */
@@ -555,6 +672,23 @@ private:
 	UFUNCTION()
 	void OnGridSlotUnhovered(int32 GridIndex, const FPointerEvent& MouseEvent);
 
+	/**
+	 * 배치 렌더러의 셀이 클릭되었을 때 호출됩니다
+	 * 아이템이 있는 셀이면 슬롯 아이템 클릭으로, 없으면 그리드 슬롯 클릭으로 처리합니다
+	 * @param CellIndex 보이는 영역 기준의 셀 인덱스
+	 * @param MouseEvent 마우스 이벤트
+	 */
+	void OnRendererCellClicked(int32 CellIndex, const FPointerEvent& MouseEvent);
+
+	/**
+	 * 배치 렌더러에서 마우스가 올라간 셀이 바뀌었을 때 호출됩니다
+	 * 그리드 슬롯 진입/이탈과 아이템 호버를 슬롯 위젯과 같게 처리합니다
+	 * @param PreviousCellIndex 이전 셀 인덱스 (없으면 INDEX_NONE)
+	 * @param CellIndex 새 셀 인덱스 (없으면 INDEX_NONE)
+	 * @param MouseEvent 마우스 이벤트
+	 */
+	void OnRendererHoveredCellChanged(int32 PreviousCellIndex, int32 CellIndex, const FPointerEvent& MouseEvent);
+
 	/**
 	 * 팝업 메뉴에서 분할 옵션이 선택되었을 때 호출됩니다
 	 * 스택 가능한 아이템의 일부를 분할하여 호버 아이템으로 만듭니다
@@ -589,6 +723,14 @@ private:
 
 	UFUNCTION()
 	void OnInventoryMenuToggled(bool bOpen);
+
+	/**
+	 * 그리드 모델의 배치가 한꺼번에 바뀌었을 때 호출됩니다 (그리드 정리 등)
+	 * 이 그리드의 카테고리라면 모든 슬롯 아이템 위젯을 모델에 맞춰 다시 만듭니다
+	 * @param Category 배치가 바뀐 카테고리
+	 */
+	UFUNCTION()
+	void OnGridRearranged(EInv_ItemCategory Category);
 	
 	/** 인벤토리 컴포넌트에 대한 약한 참조 */
 	TWeakObjectPtr<UInv_InventoryComponent> InventoryComponent;
@@ -604,6 +746,26 @@ private:
 	UPROPERTY(meta=(BindWidget))
 	TObjectPtr<UCanvasPanel> GridCanvasPanel;
 
+	/** 셀 레이어의 캐시 컨테이너 (bRetainStaticLayer이면 리테이너 박스, 아니면 무효화 박스) */
+	UPROPERTY()
+	TObjectPtr<UContentWidget> CellLayer;
+
+	/** 그리드 슬롯이나 배치 렌더러를 배치하는 셀 레이어의 캔버스 */
+	UPROPERTY()
+	TObjectPtr<UCanvasPanel> CellCanvasPanel;
+
+	/** 셀 레이어를 리테이너에 캐시할 때 셀 상태 대신 하이라이트를 그리는 레이어 */
+	UPROPERTY()
+	TObjectPtr<UInv_GridHighlight> HighlightLayer;
+
+	/** 아이템 레이어의 캐시 컨테이너 */
+	UPROPERTY()
+	TObjectPtr<UInvalidationBox> ItemLayer;
+
+	/** 슬롯 아이템 위젯을 배치하는 아이템 레이어의 캔버스 */
+	UPROPERTY()
+	TObjectPtr<UCanvasPanel> ItemCanvasPanel;
+
 	/** 슬롯에 배치될 아이템 위젯의 클래스 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	TSubclassOf<UInv_SlottedItem> SlottedItemClass;
@@ -621,10 +783,54 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	TSubclassOf<UInv_GridSlot> GridSlotClass;
 
-	/** 생성된 모든 그리드 슬롯 위젯들의 배열 */
+	/**
+	 * 보이는 영역의 그리드 슬롯 위젯들의 배열 (GetNumVisibleRows() x Columns)
+	 * 스크롤하면 위젯을 새로 만들지 않고 각 위젯이 표시하는 그리드 인덱스만 바꿉니다
+	 */
 	UPROPERTY()
 	TArray<TObjectPtr<UInv_GridSlot>> GridSlots;
 
+	/**
+	 * 슬롯 위젯과 슬롯 아이템 위젯 대신 하나의 Slate 위젯으로 그리드 전체를 그릴지 여부
+	 * 셀 브러시는 GridSlotClass의 기본값을 사용하며, 위젯 수와 레이아웃 비용을 줄여 큰 그리드에 유리합니다
+	 */
+	UPROPERTY(EditAnywhere, Category = "Inventory|Rendering")
+	bool bUseBatchedRenderer{false};
+
+	/**
+	 * 셀 레이어를 렌더 타깃에 캐시해 두고 셀이 바뀔 때만 다시 그릴지 여부
+	 * 하이라이트는 별도 레이어에 그려 호버 위치가 바뀌어도 캐시를 다시 그리지 않습니다
+	 * 배치 렌더러는 이미 하나의 위젯으로 캐시되므로 함께 사용하지 않습니다
+	 */
+	UPROPERTY(EditAnywhere, Category = "Inventory|Rendering", meta = (EditCondition = "!bUseBatchedRenderer"))
+	bool bRetainStaticLayer{false};
+
+	/**
+	 * 아이템 아이콘 브러시 캐시 (슬롯 아이템, 배치 렌더러, 호버 아이템이 공유)
+	 * 타일 크기와 스케일이 키에 포함되며, DPI 스케일이 바뀌면 비웁니다
+	 */
+	mutable FInv_IconBrushCache IconBrushCache;
+
+	/** 호버 아이템 브러시에 사용하는 뷰포트 스케일 (뷰포트 크기가 바뀔 때만 다시 가져옴) */
+	float ViewportScale{1.f};
+
+	/** 뷰포트 크기 변경 이벤트 핸들 */
+	FDelegateHandle ViewportResizedHandle;
+
+	/** 아이콘이 로드되는 동안 아이템에 표시할 자리 표시 브러시 (크기는 아이템 크기로 맞춰짐) */
+	UPROPERTY(EditAnywhere, Category = "Inventory|Rendering")
+	FSlateBrush IconPlaceholderBrush;
+
+	/** 로드가 끝난 아이콘을 다음 틱에 반영하도록 예약되었는지 여부 */
+	bool bIconRefreshPending{false};
+
+	/** 배치 렌더러가 스택 수량을 그릴 때 사용할 폰트 (비어있으면 기본 폰트) */
+	UPROPERTY(EditAnywhere, Category = "Inventory|Rendering", meta = (EditCondition = "bUseBatchedRenderer"))
+	FSlateFontInfo RendererStackCountFont;
+
+	/** bUseBatchedRenderer일 때 그리드를 그리는 배치 렌더러 */
+	UPROPERTY()
+	TObjectPtr<UInv_GridRenderer> GridRenderer;
 	/** 드래그 중인 아이템을 표시할 호버 아이템 위젯의 클래스 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	TSubclassOf<UInv_HoverItem> HoverItemClass;
@@ -645,17 +851,38 @@ private:
 	/** 현재 공간 쿼리 결과 */
 	FInv_SpaceQueryResult CurrentQueryResult;
 
+	/** CurrentQueryResult를 계산한 타일 파라미터 (타일 좌표와 사분면) */
+	FInv_TileParameters QueriedTileParameters;
+
+	/** CurrentQueryResult를 계산한 호버 아이템 크기 */
+	FIntPoint QueriedDimensions{0, 0};
+
+	/** CurrentQueryResult를 계산할 당시 그리드 모델의 리비전 */
+	uint32 QueriedRevision{0};
+
+	/** CurrentQueryResult와 하이라이트가 Queried* 조건에 대해 유효한지 여부 */
+	bool bHoverQueryValid{false};
+
 	/** 마우스가 캔버스 내에 있는지 여부 */
-	bool bMouseWithinCanvas;
+	bool bMouseWithinCanvas{false};
 
-	/** 이전 프레임에 마우스가 캔버스 내에 있었는지 여부 */
-	bool bLastMouseWithinCanvas;
+	/** 이전 마우스 이벤트에서 마우스가 캔버스 내에 있었는지 여부 */
+	bool bLastMouseWithinCanvas{false};
+
+	/** 마지막 마우스 이벤트의 캔버스 로컬 좌표 위치 */
+	FVector2D LastCanvasMousePosition{FVector2D::ZeroVector};
 
 	/** 마지막으로 하이라이트된 인덱스 */
-	int32 LastHighlightedIndex;
+	int32 LastHighlightedIndex{0};
 
 	/** 마지막으로 하이라이트된 차원 */
-	FIntPoint LastHighlightedDimensions;
+	FIntPoint LastHighlightedDimensions{FIntPoint::ZeroValue};
+
+	/** 마지막 하이라이트 영역에 적용한 상태 */
+	EInv_GridSlotState LastHighlightedState{EInv_GridSlotState::Unoccupied};
+
+	/** 마지막 하이라이트 영역이 아직 LastHighlightedState로 표시되어 있는지 여부 (영역 안의 셀이 다른 경로로 바뀌면 false) */
+	bool bLastHighlightIntact{false};
 
 	/** 표시 가능한 커서 위젯의 클래스 */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
@@ -696,6 +923,27 @@ private:
 	/** 각 타일의 크기 (픽셀) */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	float TileSize;
+
+	/**
+	 * 한 번에 화면에 표시하는 행 수 (0이면 모든 행 표시)
+	 * 그리드보다 적으면 이 행 수만큼의 슬롯 위젯만 만들고 마우스 휠로 스크롤합니다
+	 * GridCanvasPanel의 높이는 VisibleRows * TileSize에 맞춰야 합니다
+	 */
+	UPROPERTY(EditAnywhere, Category = "Inventory", meta = (ClampMin = "0"))
+	int32 VisibleRows{0};
+
+	/** 보이는 영역의 첫 번째 행 */
+	int32 FirstVisibleRow{0};
+
+	/** 그리드 슬롯 생성에 한 프레임에 사용할 최대 시간 (밀리초, 매 프레임 최소 한 행은 생성) */
+	UPROPERTY(EditAnywhere, Category = "Inventory|Construction", meta = (ClampMin = "0.0", Units = "ms"))
+	float ConstructionBudgetMs{1.f};
+
+	/** RequestConstruction으로 구성을 시작했는지 여부 */
+	bool bGridConstructionStarted{false};
+
+	/** 그리드 구성이 끝났는지 여부 (끝나기 전의 아이템 변경은 모델에만 반영되고 구성이 끝날 때 그려짐) */
+	bool bGridConstructed{false};
 };
 
 
@@ -6,6 +6,7 @@
 #include "Components/CanvasPanel.h"
 #include "Widgets/Inventory/InventoryBase/Inv_InventoryBase.h"
 #include "Widgets/ItemDescription/Inv_ItemDescription.h"
+#include "Widgets/Utils/Inv_IconBrushCache.h"
 #include "Inv_SpatialInventory.generated.h"
 
 class UInv_EquippedSlottedItem;
@@ -20,8 +21,9 @@ class UInv_InventoryGrid;
  * 공간 인벤토리 위젯 클래스
  * 탭 기반의 인벤토리 UI를 제공합니다
  * 장비, 소비품, 제작 재료 카테고리로 분류된 그리드를 관리합니다
+ * 틱을 사용하지 않으며, 아이템 설명 위치는 설명이 표시 중일 때 마우스 이동에 맞춰 갱신합니다
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class INVENTORY_API UInv_SpatialInventory : public UInv_InventoryBase
 {
 	GENERATED_BODY()
@@ -43,12 +45,13 @@ public:
 	virtual FReply NativeOnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
 	/**
-	 * 매 프레임마다 호출됩니다
-	 * 아이템 설명 위젯의 위치와 크기를 업데이트합니다
+	 * 마우스가 움직였을 때 호출됩니다
+	 * 아이템 설명 위젯이 표시 중이면 마우스 커서를 따라가도록 위치와 크기를 업데이트합니다
 	 * @param MyGeometry 위젯의 지오메트리 정보
-	 * @param InDeltaTime 이전 프레임으로부터의 경과 시간
+	 * @param MouseEvent 마우스 이벤트 정보
+	 * @return 처리하지 않음
 	 */
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual FReply NativeOnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 	
 	/**
 	 * 아이템을 배치할 공간이 있는지 확인합니다
@@ -84,11 +87,23 @@ public:
 	 */
 	virtual UInv_HoverItem* GetHoverItem() const override;
 
+	/**
+	 * 현재 활성화된 그리드의 호버 아이템을 90도 회전합니다
+	 */
+	virtual void RotateHoverItem() override;
+
 	/**
 	 * 현재 활성화된 그리드의 타일 크기를 가져옵니다
 	 * @return 타일 크기 (픽셀 단위)
 	 */
 	virtual float GetTileSize() const override;
+
+	/**
+	 * 장착 아이템 아이콘 브러시 캐시의 텍스처 참조를 GC에 알립니다
+	 * @param InThis 이 위젯
+	 * @param Collector 레퍼런스 콜렉터
+	 */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 private:
 
 	/**
@@ -112,6 +127,21 @@ private:
 	UFUNCTION()
 	void ShowCraftables();
 
+	/**
+	 * 인벤토리 메뉴가 열리거나 닫혔을 때 호출됩니다
+	 * 메뉴가 열리면 활성 탭의 그리드 구성을 시작합니다
+	 * @param bOpen 메뉴가 열렸는지 여부
+	 */
+	UFUNCTION()
+	void OnInventoryMenuToggled(bool bOpen);
+
+	/**
+	 * 모든 카테고리 그리드를 정리합니다
+	 * 정리 버튼이 있는 경우 버튼 클릭 시 호출됩니다
+	 */
+	UFUNCTION()
+	void TidyInventory();
+
 	/**
 	 * 장착 그리드 슬롯이 클릭되었을 때 호출됩니다
 	 * 호버 아이템을 해당 슬롯에 장착하는 로직을 처리합니다
@@ -160,6 +190,12 @@ private:
 	 */
 	void SetItemDescriptionSizeAndPosition(UInv_ItemDescription* Description, UCanvasPanel* Canvas) const;
 
+	/**
+	 * 표시 중인 아이템 설명 위젯들의 크기와 위치를 마우스 커서에 맞춰 갱신합니다
+	 * 아이템 설명이 숨겨져 있으면 아무것도 하지 않습니다
+	 */
+	void UpdateItemDescriptionPositions();
+
 	/**
 	 * 호버 아이템을 지정된 장비 슬롯에 장착할 수 있는지 확인합니다
 	 *
@@ -294,6 +330,10 @@ private:
 	UPROPERTY(meta=(BindWidget))
 	TObjectPtr<UButton> Button_Craftables;
 
+	/** 그리드 정리 버튼 (선택 사항, 블루프린트에서 바인딩됨) */
+	UPROPERTY(meta=(BindWidgetOptional))
+	TObjectPtr<UButton> Button_Tidy;
+
 	/** 현재 활성화된 그리드에 대한 약한 참조 */
 	TWeakObjectPtr<UInv_InventoryGrid> ActiveGrid;
 
@@ -322,6 +362,19 @@ private:
 
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	float EquippedDescriptionTimerDelay {0.5f};
+
+	/** 장착 슬롯의 아이템 아이콘 브러시 캐시 (장착과 교체 때마다 브러시를 새로 만들지 않도록 공유) */
+	FInv_IconBrushCache EquippedIconBrushCache;
+
+	/** 장착 아이템 아이콘이 로드되는 동안 표시할 자리 표시 브러시 */
+	UPROPERTY(EditAnywhere, Category = "Inventory")
+	FSlateBrush EquippedIconPlaceholderBrush;
+
+	/**
+	 * 장착 아이템 아이콘의 로드가 끝났을 때 호출됩니다
+	 * 장착 슬롯들의 아이템 브러시를 다시 설정합니다
+	 */
+	void OnEquippedIconLoaded();
 };
 
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Inventory/Spatial/SInv_GridRenderer.h"
+
+/**
+ * 하이라이트 레이어가 그리는 상태
+ * UMG 래퍼와 Slate 위젯이 공유합니다
+ */
+struct FInv_GridHighlightData
+{
+	/** 타일 크기 (픽셀) */
+	float TileSize{0.f};
+
+	/** 하이라이트할 셀 영역 (보이는 영역 기준, 비어있으면 그리지 않음) */
+	FIntRect CellRect;
+
+	/** 하이라이트 영역에 그릴 슬롯 상태 */
+	EInv_GridSlotState State{EInv_GridSlotState::Occupied};
+
+	/** 슬롯 상태별 셀 브러시 */
+	FInv_GridCellBrushes CellBrushes;
+};
+
+/**
+ * 그리드의 하이라이트 영역 하나만 그리는 Slate 위젯
+ * 정적인 셀 레이어 위에 겹쳐 그려, 호버 위치가 바뀌어도 캐시된 셀 레이어를 다시 그리지 않도록 합니다
+ * 입력은 받지 않습니다
+ */
+class INVENTORY_API SInv_GridHighlight : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SInv_GridHighlight) {}
+		/** 그릴 하이라이트 상태 */
+		SLATE_ARGUMENT(TSharedPtr<const FInv_GridHighlightData>, HighlightData)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+protected:
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+
+	/** 그릴 하이라이트 상태 */
+	TSharedPtr<const FInv_GridHighlightData> HighlightData;
+};
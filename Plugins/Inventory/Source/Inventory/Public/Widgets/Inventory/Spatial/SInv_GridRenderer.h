@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Inventory/GridSlots/Inv_GridSlot.h"
+
+/** 렌더러의 셀 클릭 이벤트 (보이는 영역 기준 셀 인덱스, 마우스 이벤트) */
+DECLARE_DELEGATE_TwoParams(FInv_GridCellClicked, int32, const FPointerEvent&);
+
+/** 마우스가 올라간 셀이 바뀌었을 때의 이벤트 (이전 셀, 새 셀, 마우스 이벤트), 영역 밖이면 INDEX_NONE */
+DECLARE_DELEGATE_ThreeParams(FInv_GridHoveredCellChanged, int32, int32, const FPointerEvent&);
+
+/**
+ * 렌더러가 그리는 아이템 하나의 정보 (보이는 영역 기준 픽셀 좌표)
+ */
+struct FInv_GridRenderItem
+{
+	/** 아이콘 브러시 (회전하지 않은 방향의 크기, 그리드의 아이콘 브러시 캐시가 소유) */
+	const FSlateBrush* Brush{nullptr};
+
+	/** 아이템이 차지하는 영역의 좌상단 위치 (패딩 적용) */
+	FVector2D Position{0.0, 0.0};
+
+	/** 아이템이 차지하는 영역의 크기 (회전이 반영된 크기) */
+	FVector2D Size{0.0, 0.0};
+
+	/** 아이콘을 90도 회전해 그릴지 여부 */
+	bool bRotated{false};
+
+	/** 표시할 스택 수량 (0이면 표시하지 않음) */
+	int32 StackCount{0};
+};
+
+/**
+ * 슬롯 상태별 셀 브러시와, 같은 상태가 이어지는 가로 구간을 그리는 함수
+ * 배치 렌더러와 하이라이트 레이어가 함께 사용합니다
+ */
+struct INVENTORY_API FInv_GridCellBrushes
+{
+	/**
+	 * 그리드 슬롯의 브러시로 상태별 브러시를 만듭니다
+	 * @param BrushSource 셀 브러시를 가져올 그리드 슬롯 (보통 그리드 슬롯 클래스의 기본 객체)
+	 * @param TileSize 타일 크기 (픽셀)
+	 */
+	void Init(const UInv_GridSlot* BrushSource, const float TileSize);
+
+	/**
+	 * 같은 상태가 이어지는 가로 구간을 그립니다
+	 * 이미지 브러시는 타일 반복으로 한 번에 그리고, 그 외 브러시는 셀마다 그립니다
+	 */
+	void PaintRun(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const float TileSize, const EInv_GridSlotState State, const int32 Row, const int32 FirstColumn, const int32 NumColumns) const;
+
+	/** 슬롯 상태별 셀 브러시 (EInv_GridSlotState 순서) */
+	FSlateBrush CellBrushes[4];
+
+	/** 이미지 셀 브러시를 타일 크기로 가로 반복하도록 만든 구간 브러시 (페인트마다 복사하지 않도록 미리 만듦) */
+	FSlateBrush CellRunBrushes[4];
+};
+
+/**
+ * 렌더러가 그리는 그리드 전체의 상태
+ * UMG 래퍼와 Slate 위젯이 공유합니다
+ */
+struct FInv_GridRenderData
+{
+	/** 열 수 */
+	int32 Columns{0};
+
+	/** 그리는 행 수 */
+	int32 Rows{0};
+
+	/** 타일 크기 (픽셀) */
+	float TileSize{0.f};
+
+	/** 셀마다의 슬롯 상태 (Rows x Columns) */
+	TArray<EInv_GridSlotState> CellStates;
+
+	/** 좌상단 셀 인덱스별 아이템 */
+	TMap<int32, FInv_GridRenderItem> Items;
+
+	/** 슬롯 상태별 셀 브러시 */
+	FInv_GridCellBrushes CellBrushes;
+
+	/** 스택 수량 텍스트 폰트 */
+	FSlateFontInfo StackCountFont;
+};
+
+/**
+ * 그리드 슬롯과 아이템 아이콘을 하나의 위젯에서 그리는 Slate 위젯
+ * 셀마다 위젯을 만드는 대신 OnPaint에서 배경과 하이라이트, 아이콘, 스택 수량을 몇 개의 드로우 엘리먼트로 묶어 그립니다
+ * 히트 테스트도 마우스 위치를 셀 인덱스로 직접 변환해 처리합니다
+ */
+class INVENTORY_API SInv_GridRenderer : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SInv_GridRenderer) {}
+		/** 그릴 그리드 상태 */
+		SLATE_ARGUMENT(TSharedPtr<const FInv_GridRenderData>, RenderData)
+		/** 셀이 클릭되었을 때 */
+		SLATE_EVENT(FInv_GridCellClicked, OnCellClicked)
+		/** 마우스가 올라간 셀이 바뀌었을 때 */
+		SLATE_EVENT(FInv_GridHoveredCellChanged, OnHoveredCellChanged)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+
+protected:
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+
+	/**
+	 * 마우스 위치의 셀 인덱스를 계산합니다
+	 * @return 보이는 영역 기준 셀 인덱스, 영역 밖이면 INDEX_NONE
+	 */
+	int32 GetCellIndexAt(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) const;
+
+	/** 그릴 그리드 상태 */
+	TSharedPtr<const FInv_GridRenderData> RenderData;
+
+	/** 셀 클릭 이벤트 */
+	FInv_GridCellClicked OnCellClicked;
+
+	/** 마우스가 올라간 셀 변경 이벤트 */
+	FInv_GridHoveredCellChanged OnHoveredCellChanged;
+
+	/** 현재 마우스가 올라가 있는 셀 */
+	int32 HoveredCellIndex{INDEX_NONE};
+};
@@ -26,8 +26,6 @@ public:
      * @return 위젯의 desired size (픽셀 단위)
      */
     FVector2D GetBoxSize() const;
-
-    virtual void SetVisibility(ESlateVisibility InVisibility) override;
 private:
 
     /** 위젯의 크기를 결정하는 SizeBox 컴포넌트 */
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UInv_CompositeBase;
+class UTexture2D;
+
+/** 설명 항목이 리프 위젯에 설정하는 데이터 종류 */
+enum class EInv_DescriptionEntryType : uint8
+{
+	/** 위젯을 확장만 합니다 */
+	Expand,
+
+	/** UInv_Leaf_Image에 아이콘과 크기를 설정합니다 */
+	Image,
+
+	/** UInv_Leaf_Text에 텍스트를 설정합니다 */
+	Text,
+
+	/** UInv_Leaf_LabeledValue에 라벨과 값을 설정합니다 */
+	LabeledValue
+};
+
+/**
+ * 설명 위젯의 리프 하나에 적용할 포맷된 데이터
+ */
+struct FInv_DescriptionEntry
+{
+	/** 데이터 종류 */
+	EInv_DescriptionEntryType Type{EInv_DescriptionEntryType::Expand};
+
+	/** 적용할 리프 위젯의 FragmentTag */
+	FGameplayTag Tag;
+
+	/** 텍스트, 또는 라벨 값 항목의 라벨 */
+	FText Text;
+
+	/** 라벨 값 항목의 포맷된 값 */
+	FText Value;
+
+	/** 라벨을 숨길지 여부 */
+	bool bCollapseLabel{false};
+
+	/** 값을 숨길지 여부 */
+	bool bCollapseValue{false};
+
+	/** 이미지 항목의 아이콘 */
+	TSoftObjectPtr<UTexture2D> Icon;
+
+	/** 이미지 항목의 아이콘 크기 */
+	FVector2D IconDimensions{FVector2D::ZeroVector};
+};
+
+/**
+ * 아이템 설명 위젯에 적용할 포맷된 설명 항목들
+ * 프래그먼트의 동화(숫자 포맷, 수정자 순회)는 페이로드를 만들 때 한 번만 수행되고,
+ * 위젯에는 태그 인덱스로 찾은 리프에 항목을 적용하기만 합니다
+ * 아이템은 매니페스트 리비전과 로캘이 같으면 페이로드를 재사용합니다 (UInv_InventoryItem::GetDescriptionPayload)
+ */
+struct INVENTORY_API FInv_ItemDescriptionPayload
+{
+public:
+
+	/**
+	 * 페이로드를 컴포지트 위젯에 적용합니다
+	 * 이전 적용에서 확장되었지만 이번 페이로드에 없는 리프만 축소됩니다
+	 * @param Composite 설명 컴포지트 위젯
+	 */
+	void ApplyTo(UInv_CompositeBase* Composite) const;
+
+	/**
+	 * 페이로드가 주어진 리비전과 로캘로 만들어졌는지 확인합니다
+	 * @param InManifestRevision 아이템의 매니페스트 리비전
+	 * @param InLocale 현재 로캘 이름
+	 * @return 재사용할 수 있으면 true
+	 */
+	bool IsValidFor(const uint32 InManifestRevision, const FString& InLocale) const
+	{
+		return bBuilt && ManifestRevision == InManifestRevision && Locale == InLocale;
+	}
+
+	/**
+	 * 항목을 비우고 새 리비전과 로캘로 다시 만들 준비를 합니다
+	 * @param InManifestRevision 아이템의 매니페스트 리비전
+	 * @param InLocale 현재 로캘 이름
+	 */
+	void Reset(const uint32 InManifestRevision, const FString& InLocale);
+
+	/** 리프에 적용할 항목들 (프래그먼트 순서) */
+	TArray<FInv_DescriptionEntry> Entries;
+
+private:
+
+	/** 페이로드를 만든 매니페스트 리비전 */
+	uint32 ManifestRevision{0};
+
+	/** 페이로드를 만든 로캘 (숫자 포맷이 로캘에 따라 다름) */
+	FString Locale;
+
+	/** 한 번이라도 만들어졌는지 여부 */
+	bool bBuilt{false};
+};
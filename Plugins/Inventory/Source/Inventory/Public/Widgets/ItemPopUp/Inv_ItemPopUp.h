@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Widgets/Pool/Inv_PooledWidget.h"
 #include "Inv_ItemPopUp.generated.h"
 
 class USizeBox;
@@ -24,13 +25,16 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FPopUpMenuConsume, int32, Index);
  * 인벤토리 그리드에서 마우스 오른쪽 클릭을하면 아이템 팝업이 뜨는 위젯
  */
 UCLASS()
-class INVENTORY_API UInv_ItemPopUp : public UUserWidget
+class INVENTORY_API UInv_ItemPopUp : public UUserWidget, public IInv_PooledWidget
 {
     GENERATED_BODY()
 public:
     virtual void NativeOnInitialized() override;
     virtual void NativeOnMouseLeave(const FPointerEvent& InMouseEvent) override;
 
+    /** 위젯 풀에 반환될 때 델리게이트 바인딩과 숨긴 버튼들을 초기화 */
+    virtual void OnReleasedToPool_Implementation() override;
+
     /** 슬라이더로 설정된 분리 수량을 반환 (소수점 버림) */
     int32 GetSplitAmount() const;
 
@@ -61,6 +65,9 @@ public:
     /** 사용 버튼 클릭 시 실행될 델리게이트 */
     FPopUpMenuConsume OnConsume;
 private:
+    /** 팝업을 닫고 위젯 풀에 반환 */
+    void Dismiss();
+
     /** 분리 버튼 클릭 시 호출되는 콜백 함수 */
     UFUNCTION()
     void SplitButtonClicked();
@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Inv_PooledWidget.generated.h"
+
+/**
+ * 위젯 풀에서 재사용되는 위젯을 위한 UInterface 클래스
+ * 이 클래스는 수정할 필요가 없습니다
+ */
+UINTERFACE()
+class UInv_PooledWidget : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * 위젯 풀에서 재사용되는 위젯 인터페이스
+ * 풀에 반환될 때 이전 사용의 상태(아이템 참조, 바인딩된 델리게이트, 숨긴 요소 등)를 초기화합니다
+ */
+class INVENTORY_API IInv_PooledWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * 위젯이 풀에 반환될 때 호출됩니다
+	 * 부모에서 제거된 뒤 호출되며, 다음에 꺼낸 쪽이 새로 만든 위젯처럼 사용할 수 있도록 상태를 되돌려야 합니다
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Inventory")
+	void OnReleasedToPool();
+};
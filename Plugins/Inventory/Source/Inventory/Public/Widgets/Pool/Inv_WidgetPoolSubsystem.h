@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "Inv_WidgetPoolSubsystem.generated.h"
+
+/**
+ * 위젯 클래스 하나의 재사용 대기 목록
+ */
+USTRUCT()
+struct FInv_PooledWidgetList
+{
+	GENERATED_BODY()
+
+	/** 풀에 반환되어 재사용을 기다리는 위젯들 */
+	UPROPERTY()
+	TArray<TObjectPtr<UUserWidget>> Widgets;
+};
+
+/**
+ * 플레이어별 인벤토리 위젯 풀
+ * 슬롯 아이템, 호버 아이템, 팝업 메뉴, 장착 아이템처럼 자주 만들고 버리는 위젯을 클래스별로 보관했다가 재사용합니다
+ * 반환된 위젯은 IInv_PooledWidget::OnReleasedToPool로 상태를 초기화합니다
+ */
+UCLASS()
+class INVENTORY_API UInv_WidgetPoolSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * 플레이어 컨트롤러의 위젯 풀을 가져옵니다
+	 * @param PlayerController 대상 플레이어 컨트롤러
+	 * @return 위젯 풀, 로컬 플레이어가 없으면 nullptr
+	 */
+	static UInv_WidgetPoolSubsystem* Get(const APlayerController* PlayerController);
+
+	/**
+	 * 플레이어의 위젯 풀에서 위젯을 꺼냅니다
+	 * 풀이 없거나 비어있으면 새로 생성합니다
+	 * @param OwningPlayer 위젯을 소유할 플레이어 컨트롤러
+	 * @param WidgetClass 위젯 클래스
+	 * @return 위젯
+	 */
+	template <typename WidgetT>
+	static WidgetT* AcquireWidget(APlayerController* OwningPlayer, TSubclassOf<WidgetT> WidgetClass);
+
+	/**
+	 * 위젯을 소유 플레이어의 위젯 풀에 반환합니다
+	 * 위젯은 부모에서 제거되며, 풀이 없으면 제거만 합니다
+	 * @param Widget 반환할 위젯
+	 */
+	static void ReleaseWidget(UUserWidget* Widget);
+
+	/**
+	 * 풀에서 위젯을 꺼내거나 새로 생성합니다
+	 * @param OwningPlayer 위젯을 소유할 플레이어 컨트롤러
+	 * @param WidgetClass 위젯 클래스
+	 * @return 위젯
+	 */
+	UUserWidget* Acquire(APlayerController* OwningPlayer, TSubclassOf<UUserWidget> WidgetClass);
+
+	/**
+	 * 위젯을 부모에서 제거하고 상태를 초기화한 뒤 풀에 넣습니다
+	 * 클래스별 보관 수를 넘으면 풀에 넣지 않고 버립니다
+	 * @param Widget 반환할 위젯
+	 */
+	void Release(UUserWidget* Widget);
+
+	/** 풀에 보관된 모든 위젯을 버립니다 */
+	void Empty();
+
+private:
+
+	/** 클래스별로 보관하는 최대 위젯 수 */
+	static constexpr int32 MaxPooledWidgetsPerClass{64};
+
+	/** 위젯 클래스별 재사용 대기 목록 */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FInv_PooledWidgetList> Pools;
+};
+
+template <typename WidgetT>
+WidgetT* UInv_WidgetPoolSubsystem::AcquireWidget(APlayerController* OwningPlayer, TSubclassOf<WidgetT> WidgetClass)
+{
+	if (UInv_WidgetPoolSubsystem* WidgetPool = Get(OwningPlayer))
+	{
+		return Cast<WidgetT>(WidgetPool->Acquire(OwningPlayer, WidgetClass));
+	}
+	return CreateWidget<WidgetT>(OwningPlayer, WidgetClass);
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/SoftObjectPath.h"
+
+class UTexture2D;
+struct FStreamableHandle;
+
+/**
+ * 아이템 아이콘 브러시 캐시
+ * (아이콘, 그리드 크기, 패딩, 타일 크기, 스케일)이 같은 아이템은 같은 브러시를 공유하므로
+ * 아이템을 배치하거나 집을 때마다 브러시를 새로 만들지 않습니다
+ * 브러시는 캐시가 비워질 때까지 같은 주소에 유지되어 포인터로 참조할 수 있습니다
+ * 캐시는 UObject가 아니므로 소유자가 AddReferencedObjects로 아이콘을 GC에 알려야 합니다
+ *
+ * 아이콘은 소프트 레퍼런스이며, 로드되지 않은 아이콘은 자리 표시 브러시를 반환하고 비동기로 로드합니다
+ * 로드가 끝나면 캐시된 브러시를 그 자리에서 아이콘으로 바꾸고 OnIconLoaded를 호출합니다
+ */
+struct INVENTORY_API FInv_IconBrushCache
+{
+public:
+
+	FInv_IconBrushCache() = default;
+	~FInv_IconBrushCache();
+
+	/**
+	 * 아이콘 브러시를 찾거나 새로 만듭니다
+	 * 브러시 크기는 GridSize * (TileSize - Padding * 2) * Scale 입니다 (회전하지 않은 방향)
+	 * @param Icon 아이콘 텍스처
+	 * @param GridSize 아이템이 차지하는 그리드 크기
+	 * @param Padding 타일 안쪽 패딩
+	 * @param TileSize 타일 크기 (픽셀)
+	 * @param Scale 추가로 곱할 스케일 (DPI 스케일이 적용되지 않는 커서 위젯 등에 사용)
+	 * @return 캐시된 브러시 (캐시가 비워질 때까지 유효), 아이콘이 로드 중이면 자리 표시 브러시
+	 */
+	const FSlateBrush& FindOrAdd(const TSoftObjectPtr<UTexture2D>& Icon, const FIntPoint& GridSize, const float Padding, const float TileSize, const float Scale = 1.f);
+
+	/**
+	 * 캐시를 비우고 진행 중인 로드를 취소합니다
+	 * 이전에 반환한 브러시 참조는 모두 무효가 됩니다
+	 */
+	void Reset();
+
+	/**
+	 * 모든 브러시를 사용하지 않은 것으로 표시합니다
+	 * 이후 FindOrAdd로 다시 요청된 브러시만 RemoveUnused에서 남습니다
+	 */
+	void ResetUsage();
+
+	/**
+	 * ResetUsage 이후 요청되지 않은 브러시를 버려 화면에 없는 아이콘이 메모리에서 내려갈 수 있게 합니다
+	 * 버린 브러시의 참조는 무효가 됩니다
+	 */
+	void RemoveUnused();
+
+	/**
+	 * 아이콘이 로드되는 동안 사용할 자리 표시 브러시를 설정합니다
+	 * @param InPlaceholderBrush 자리 표시 브러시 (크기는 아이콘 브러시 크기로 바뀜)
+	 */
+	void SetPlaceholderBrush(const FSlateBrush& InPlaceholderBrush) { PlaceholderBrush = InPlaceholderBrush; }
+
+	/**
+	 * 캐시된 브러시의 아이콘 텍스처를 GC에 알립니다
+	 * @param Collector 레퍼런스 콜렉터
+	 */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+	/** 캐시된 브러시 수 */
+	int32 Num() const { return Entries.Num(); }
+
+	/** 자리 표시 브러시였던 아이콘이 로드되어 브러시가 바뀌었을 때 호출됩니다 */
+	FSimpleDelegate OnIconLoaded;
+
+private:
+
+	/** 브러시를 구분하는 키 */
+	struct FKey
+	{
+		FSoftObjectPath Icon;
+		FIntPoint GridSize{1, 1};
+		float Padding{0.f};
+		float TileSize{0.f};
+		float Scale{1.f};
+
+		bool operator==(const FKey& Other) const
+		{
+			return Icon == Other.Icon && GridSize == Other.GridSize && Padding == Other.Padding && TileSize == Other.TileSize && Scale == Other.Scale;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Icon), GetTypeHash(Key.GridSize));
+			Hash = HashCombine(Hash, GetTypeHash(Key.Padding));
+			Hash = HashCombine(Hash, GetTypeHash(Key.TileSize));
+			return HashCombine(Hash, GetTypeHash(Key.Scale));
+		}
+	};
+
+	/** 캐시된 브러시와 GC 참조용 아이콘 */
+	struct FEntry
+	{
+		/** 로드된 아이콘 (로드 중이면 nullptr) */
+		TObjectPtr<UTexture2D> Icon;
+
+		TUniquePtr<FSlateBrush> Brush;
+
+		/** ResetUsage 이후 요청되었는지 여부 */
+		bool bUsed{true};
+	};
+
+	/** 아이콘 로드가 끝났을 때 해당 아이콘의 브러시들을 바꿉니다 */
+	void HandleIconLoaded(const FSoftObjectPath Path);
+
+	/** 로드 중인 아이콘의 스트리밍 핸들을 모두 취소합니다 */
+	void CancelPendingLoads();
+
+	/** 키별 캐시 항목 */
+	TMap<FKey, FEntry> Entries;
+
+	/** 로드 중인 아이콘별 스트리밍 핸들 */
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> PendingLoads;
+
+	/** 아이콘이 로드되는 동안 사용할 브러시 */
+	FSlateBrush PlaceholderBrush{FSlateNoResource()};
+};
@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "Inv_IconStreamingSubsystem.generated.h"
+
+class UTexture2D;
+struct FInv_ItemManifest;
+
+/**
+ * 플레이어별 아이템 아이콘 스트리밍
+ * 아이콘은 소프트 레퍼런스이므로 화면에 필요해질 때 비동기로 로드합니다
+ * 곧 보일 아이콘(바라보는 픽업, 새로 들어온 아이템)은 미리 로드를 시작해 최근 몇 개만 메모리에 유지합니다
+ */
+UCLASS()
+class INVENTORY_API UInv_IconStreamingSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * 플레이어 컨트롤러의 아이콘 스트리밍 서브시스템을 가져옵니다
+	 * @param PlayerController 대상 플레이어 컨트롤러
+	 * @return 서브시스템, 로컬 플레이어가 없으면 nullptr
+	 */
+	static UInv_IconStreamingSubsystem* Get(const APlayerController* PlayerController);
+
+	/**
+	 * 아이콘을 비동기로 로드합니다
+	 * 이미 로드된 아이콘이면 델리게이트가 바로 호출됩니다
+	 * @param Icon 로드할 아이콘
+	 * @param OnLoaded 로드가 끝나면 호출할 델리게이트
+	 * @return 스트리밍 핸들 (핸들을 유지하는 동안 아이콘이 메모리에 남음), 아이콘이 없으면 nullptr
+	 */
+	static TSharedPtr<FStreamableHandle> RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon, FStreamableDelegate OnLoaded = FStreamableDelegate());
+
+	/**
+	 * 아이템 매니페스트의 아이콘을 미리 로드합니다
+	 * @param PlayerController 아이콘을 볼 플레이어 컨트롤러
+	 * @param Manifest 아이템 매니페스트
+	 */
+	static void PrefetchItemIcon(const APlayerController* PlayerController, const FInv_ItemManifest& Manifest);
+
+	/**
+	 * 아이콘을 미리 로드하고 최근 프리페치 목록에 넣습니다
+	 * 목록이 가득 차면 가장 오래된 아이콘의 핸들을 놓아 GC가 내릴 수 있게 합니다
+	 * @param Icon 미리 로드할 아이콘
+	 */
+	void Prefetch(const TSoftObjectPtr<UTexture2D>& Icon);
+
+private:
+
+	/** 유지하는 최대 프리페치 아이콘 수 */
+	static constexpr int32 MaxPrefetchedIcons{32};
+
+	/** 프리페치한 아이콘과 스트리밍 핸들 (오래된 순서, 다시 요청되면 맨 뒤로 옮김) */
+	TArray<TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>> PrefetchHandles;
+};